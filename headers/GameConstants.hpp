@@ -9,13 +9,89 @@ const int WINDOW_HEIGHT = 600;
 const int LANES = 3; // Modifié pour avoir 3 voies
 const int LANE_WIDTH = WINDOW_WIDTH / LANES;
 
-// FPS cible
+// FPS cible par défaut (voir FramePacer pour la limitation)
 const int FPS = 60;
-const int FRAME_DELAY = 1000 / FPS;
+
+// Fréquence de la simulation à pas fixe (indépendante du rendu)
+const int SIM_HZ = 120;
+const float SIM_DT = 1.0f / SIM_HZ;          // Durée d'un pas en secondes
+const double SIM_STEP_MS = 1000.0 / SIM_HZ;  // Durée d'un pas en millisecondes
+
+// Durée maximale rattrapée en une image (évite l'emballement après un gel)
+const float MAX_FRAME_TIME = 0.25f;
+
+// Vitesse de défilement ajoutée par unité de vitesse du vélo (pixels/seconde)
+const int VELO_SPEED_SCALE = 60;
+
+// Tailles d'affichage du vélo et des murs (les images de l'archive y sont redimensionnées)
+const int BIKE_WIDTH = 70;
+const int BIKE_HEIGHT = 80;
+const int WALL_WIDTH = 120;
+const int WALL_HEIGHT = 30;
 
 // Durée du jeu en secondes
 const int GAME_TIME = 60;
 
+// Règles de la partie, partagées par le jeu et l'environnement vectorisé (VecEnv)
+const int BIKE_Y = WINDOW_HEIGHT - BIKE_HEIGHT - 50;  // Position verticale fixe du vélo
+const int BIKE_MOVE_SPEED = 600;     // Glissement entre deux voies (pixels/seconde)
+const int BIKE_START_SPEED = 3;      // Vitesse en début de partie
+const int BIKE_MIN_SPEED = 1;
+const int BIKE_MAX_SPEED = 10;
+const int WALL_SPEED = 180;          // Défilement propre des murs (pixels/seconde)
+const int OBSTACLE_INTERVAL_MS = 2000;  // Délai entre deux vagues de murs
+
+// Chemins des images partagées via le cache de textures
+const char* const ROAD_TEXTURE_PATH = "assets/road.png";
+const char* const WALL_TEXTURE_PATH = "assets/wall.png";
+const char* const BIKE_TEXTURE_PATH = "assets/bike.png";
+const char* const MENU_BACKGROUND_PATH = "assets/menubackg.png";
+
+// road.png porte les marquages peints des LANES voies : les autres pistes
+// utilisent la route de secours, rangée dans le cache sous cette clé
+const char* const PLAIN_ROAD_TEXTURE_KEY = "plain-road";
+
+/* Taille d'affichage d'une image partagée : l'image est rééchantillonnée à
+   cette taille au chargement (ou à l'empaquetage) */
+struct ImageDrawSize {
+    const char* path;
+    int width;
+    int height;
+};
+
+const ImageDrawSize IMAGE_DRAW_SIZES[] = {
+    {MENU_BACKGROUND_PATH, WINDOW_WIDTH, WINDOW_HEIGHT},  // Plein écran
+    {ROAD_TEXTURE_PATH, WINDOW_WIDTH, WINDOW_HEIGHT},     // Couche de route
+    {BIKE_TEXTURE_PATH, BIKE_WIDTH, BIKE_HEIGHT},
+    {WALL_TEXTURE_PATH, WALL_WIDTH, WALL_HEIGHT}
+};
+
+// Archive de ressources pré-décodées (produite par tools/assetpack.cpp)
+const char* const ASSET_ARCHIVE_PATH = "assets.pak";
+
+// Police et musiques, lues en mémoire par le chargeur de ressources
+const char* const FONT_PATH = "assets/OpenSans-Regular.ttf";
+const char* const MENU_MUSIC_PATH = "assets/menu_music.wav";
+const char* const GAME_MUSIC_PATH = "assets/game1_music.mp3";
+
+// Effet de fin de partie (les autres effets sont synthétisés au chargement)
+const char* const GAME_OVER_SOUND_PATH = "game-over-39-199830.mp3";
+
+// Taille par défaut du tampon du périphérique audio, en trames (--audio-buffer) :
+// 512 trames à 44,1 kHz, soit environ 12 ms entre un effet et sa sortie
+const int AUDIO_BUFFER_SAMPLES = 512;
+const int AUDIO_BUFFER_MIN = 128;   // Plus petit : sous-débits probables
+const int AUDIO_BUFFER_MAX = 8192;  // Plus grand : latence de près de 200 ms
+
+// Fichier de trace du profileur (format Chrome Trace)
+const char* const PROFILE_TRACE_PATH = "velo_trace.json";
+
+// Images de l'état PLAYING ignorées par le test d'allocations (montée en charge)
+const int ALLOC_WARMUP_FRAMES = 120;
+
+// Capture des temps d'image du panneau de performances (F4)
+const char* const FRAME_CAPTURE_PATH = "velo_frametimes.csv";
+
 // Probabilité de génération d'obstacles (pourcentage)
 const int OBSTACLE_SPAWN_RATE = 40;
 
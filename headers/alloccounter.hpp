@@ -0,0 +1,78 @@
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+#include <SDL2/SDL.h>
+
+/*
+Compteur d'allocations sur le tas
+- En l'absence de NDEBUG, les opérateurs globaux new/delete sont remplacés par
+  des versions qui comptent chaque allocation avant d'appeler malloc/free
+- installSDLHooks() fait de même pour les allocations internes de SDL
+  (SDL_malloc, donc aussi SDL_image, SDL_ttf et SDL_mixer)
+- Le suivi par image relève les compteurs du thread appelant au début et à la
+  fin de chaque image (les threads de chargement, de musique et audio n'y
+  comptent pas) et cumule le résultat par étiquette (l'état du jeu)
+Sert à vérifier qu'une boucle ne fait plus aucune allocation.
+En version optimisée (NDEBUG), seuls les appels SDL sont comptés.
+*/
+namespace AllocCounter {
+    // Nombre maximal d'étiquettes du suivi par image
+    const int MAX_TAGS = 8;
+
+    /* Cumul des images d'une étiquette */
+    struct TagStats {
+        Uint64 frames;                 // Images suivies
+        Uint64 framesWithAllocations;  // Images ayant alloué au moins une fois
+        Uint64 allocations;            // Allocations cumulées
+        Uint64 bytes;                  // Octets alloués cumulés
+        Uint64 maxAllocations;         // Maximum d'allocations en une image
+    };
+
+    /*
+    Indique si les opérateurs new/delete sont comptés (version de debug)
+    */
+    bool isEnabled();
+
+    /*
+    Remplace les fonctions mémoire de SDL par des versions qui comptent
+    À appeler avant SDL_Init, avant toute allocation faite par SDL
+    return true si les fonctions ont été installées
+    */
+    bool installSDLHooks();
+
+    /*
+    Nombre d'allocations depuis le lancement (new et SDL_malloc confondus)
+    */
+    Uint64 getCount();
+
+    /*
+    Octets alloués depuis le lancement (cumul, les libérations ne sont pas déduites)
+    */
+    Uint64 getBytes();
+
+    /*
+    Démarre le suivi d'une image (allocations du thread appelant uniquement)
+    tag Étiquette de l'image (entre 0 et MAX_TAGS - 1)
+    */
+    void beginFrame(int tag);
+
+    /*
+    Termine le suivi de l'image en cours et cumule ses compteurs
+    return Nombre d'allocations faites pendant l'image
+    */
+    Uint64 endFrame();
+
+    /*
+    Retourne le cumul d'une étiquette
+    */
+    const TagStats& getTagStats(int tag);
+
+    /*
+    Affiche le cumul de chaque étiquette suivie sur la sortie standard
+    names Nom de chaque étiquette
+    count Nombre de noms
+    */
+    void printStats(const char* const names[], int count);
+}
+
+#endif // ALLOC_COUNTER_HPP
@@ -0,0 +1,113 @@
+#ifndef ASSET_ARCHIVE_HPP
+#define ASSET_ARCHIVE_HPP
+
+#include <SDL2/SDL.h>
+#include <string>
+
+/*
+Format de l'archive de ressources (fichier produit par tools/assetpack.cpp)
+- En-tête : signature "VELOPAK1" puis nombre d'entrées
+- Table d'index : une PakEntry par ressource, triée par nom
+- Données : alignées sur 16 octets, référencées par offset depuis le début du fichier
+Les images sont stockées en RGBA 8 bits (SDL_PIXELFORMAT_RGBA32), déjà
+redimensionnées à leur taille d'affichage. Les autres fichiers (police,
+musiques) sont copiés tels quels. Les entiers sont en petit-boutiste.
+*/
+const char PAK_MAGIC[8] = {'V', 'E', 'L', 'O', 'P', 'A', 'K', '1'};
+const Uint32 PAK_ALIGNMENT = 16;
+
+/* Types d'entrées de l'archive */
+enum PakEntryType {
+    PAK_IMAGE = 0, /* Pixels RGBA prêts à l'envoi au GPU */
+    PAK_BLOB = 1   /* Contenu brut d'un fichier */
+};
+
+struct PakHeader {
+    char magic[8];
+    Uint32 entryCount;
+    Uint32 reserved;
+};
+
+struct PakEntry {
+    char name[56];   // Chemin d'origine (clé de recherche), terminé par un zéro
+    Uint32 type;     // PakEntryType
+    Uint32 width;    // Dimensions des images (0 pour les autres fichiers)
+    Uint32 height;
+    Uint32 pitch;    // Octets par ligne de pixels
+    Uint64 offset;   // Position des données dans le fichier
+    Uint64 size;     // Taille des données en octets
+};
+
+/*
+Classe AssetArchive - Lecture de l'archive projetée en mémoire
+Le fichier est projeté (mmap / MapViewOfFile) plutôt que lu :
+- Aucune copie ni décodage, les surfaces pointent directement dans la projection
+- Les pages ne sont chargées par le système qu'au premier accès
+La projection doit rester ouverte tant que les polices et musiques ouvertes
+depuis l'archive sont utilisées.
+*/
+class AssetArchive {
+public:
+    AssetArchive();
+
+    /*
+    Destructeur - Ferme la projection
+    */
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /*
+    Projette une archive en mémoire et vérifie son index
+    path Chemin de l'archive
+    return true si l'archive est utilisable
+    */
+    bool open(const char* path);
+
+    /*
+    Ferme la projection
+    */
+    void close();
+
+    bool isOpen() const { return base != nullptr; }
+
+    /*
+    Recherche une entrée par son chemin d'origine
+    return Entrée trouvée, ou nullptr
+    */
+    const PakEntry* find(const std::string& name) const;
+
+    /*
+    Crée une surface qui partage les pixels projetés (aucune copie)
+    La surface doit être libérée avant la fermeture de l'archive
+    */
+    SDL_Surface* createSurface(const PakEntry& entry) const;
+
+    /*
+    Ouvre un flux en lecture sur les données d'une entrée
+    */
+    SDL_RWops* openRW(const PakEntry& entry) const;
+
+    size_t getMappedBytes() const { return mappedSize; }
+
+private:
+    const Uint8* base;        // Début de la projection
+    size_t mappedSize;
+    const PakEntry* entries;  // Table d'index (dans la projection)
+    Uint32 entryCount;
+
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+
+    /*
+    Vérifie la signature et que chaque entrée reste dans le fichier
+    */
+    bool validate() const;
+};
+
+#endif // ASSET_ARCHIVE_HPP
@@ -0,0 +1,101 @@
+#ifndef ASSET_LOADER_HPP
+#define ASSET_LOADER_HPP
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "threadpool.hpp"
+#include "texturecache.hpp"
+
+/*
+Classe AssetLoader - Chargement des ressources en parallèle
+Le travail coûteux est fait sur les threads de travail :
+- Images : décodage PNG, réduction à la taille d'affichage et conversion
+  au format natif du renderer
+- Polices et musiques : lecture des fichiers en mémoire
+Seul l'envoi des textures au GPU reste sur le thread de rendu (uploadImages),
+car SDL_Renderer n'est pas utilisable depuis un autre thread.
+*/
+class AssetLoader {
+public:
+    /*
+    Constructeur
+    pool Threads de travail utilisés pour les chargements
+    */
+    explicit AssetLoader(ThreadPool& pool);
+
+    /*
+    Destructeur - Attend les chargements en cours et libère les surfaces non envoyées
+    */
+    ~AssetLoader();
+
+    /*
+    Définit le format de pixels dans lequel les images sont converties
+    format Format SDL (SDL_PIXELFORMAT_UNKNOWN pour garder le format du fichier)
+    */
+    void setSurfaceFormat(Uint32 format) { surfaceFormat = format; }
+
+    /*
+    Demande le décodage d'une image
+    path Chemin de l'image (clé utilisée ensuite par le TextureCache)
+    width, height Taille d'affichage (0 pour garder la taille du fichier)
+    */
+    void loadImage(const std::string& path, int width = 0, int height = 0);
+
+    /*
+    Demande la lecture d'un fichier en mémoire
+    path Chemin du fichier
+    */
+    void loadFile(const std::string& path);
+
+    /*
+    Envoie au cache les images décodées depuis le dernier appel (thread de rendu)
+    cache Cache de textures destinataire
+    return Nombre de textures créées
+    */
+    int uploadImages(TextureCache& cache);
+
+    /*
+    Récupère le contenu d'un fichier lu
+    path Chemin passé à loadFile
+    data Reçoit le contenu du fichier
+    return true si le fichier a été lu, false s'il n'est pas encore prêt ou illisible
+    */
+    bool takeFile(const std::string& path, std::vector<Uint8>& data);
+
+    /*
+    Indique si un fichier a été traité (lu ou en échec)
+    */
+    bool isFileReady(const std::string& path);
+
+    // Avancement des chargements
+    int getTotal() const { return total; }
+    int getCompleted() const { return completed.load(); }
+    bool isDone() const { return completed.load() == total; }
+    float getProgress() const { return total > 0 ? static_cast<float>(completed.load()) / total : 1.0f; }
+
+private:
+    struct DecodedImage {
+        std::string path;
+        SDL_Surface* surface;
+    };
+
+    struct LoadedFile {
+        std::vector<Uint8> data;
+        bool ok;
+    };
+
+    ThreadPool& pool;
+    Uint32 surfaceFormat;
+    int total;
+    std::atomic<int> completed;
+
+    std::mutex mutex;  // Protège les deux conteneurs suivants
+    std::vector<DecodedImage> decoded;
+    std::unordered_map<std::string, LoadedFile> files;
+};
+
+#endif // ASSET_LOADER_HPP
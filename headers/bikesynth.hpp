@@ -0,0 +1,94 @@
+#ifndef BIKE_SYNTH_HPP
+#define BIKE_SYNTH_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <atomic>
+
+/*
+Classe BikeSynth - Bruit du vélo synthétisé dans le mixeur
+Un effet Mix_RegisterEffect sur MIX_CHANNEL_POST ajoute au mixage final :
+- Le bourdonnement des pneus, dont la hauteur suit la vitesse
+- Les cliquetis de la chaîne, d'autant plus serrés que la vitesse est élevée
+Le jeu publie la vitesse par une simple écriture atomique (aucun verrou côté
+jeu) ; le thread audio la lit une fois par bloc et la lisse pour éviter les
+sauts de hauteur à chaque changement de vitesse.
+Le signal est calculé par blocs de BLOCK_FRAMES trames, en boucles de
+longueur fixe sans branchement ni dépendance d'un échantillon au précédent
+(vectorisables) : la phase est obtenue sous forme fermée et le bruit lu dans
+une table. Un bloc entamé à la fin d'un callback est terminé au suivant.
+Seul le format 16 bits signé (MIX_DEFAULT_FORMAT) est pris en charge.
+*/
+class BikeSynth {
+public:
+    // Trames calculées par bloc (paramètres constants ou en rampe sur un bloc)
+    static const int BLOCK_FRAMES = 64;
+
+    BikeSynth();
+
+    /*
+    Destructeur - Débranche l'effet
+    */
+    ~BikeSynth();
+
+    BikeSynth(const BikeSynth&) = delete;
+    BikeSynth& operator=(const BikeSynth&) = delete;
+
+    /*
+    Branche l'effet sur le mixage final (Mix_OpenAudio doit avoir réussi)
+    return true si l'effet est branché, false si le format audio n'est pas pris en charge
+    */
+    bool start();
+
+    /*
+    Débranche l'effet
+    */
+    void stop();
+
+    /*
+    Publie la vitesse du vélo (thread du jeu, sans verrou ni allocation)
+    speed Vitesse entre 0 (silence) et BIKE_MAX_SPEED
+    */
+    void setSpeed(int speed) { targetSpeed.store(speed, std::memory_order_relaxed); }
+
+    bool isRunning() const { return running; }
+
+    // Part d'un cœur occupée par la synthèse : temps de calcul / durée du son produit
+    double getLoad() const;
+
+private:
+    // Table de bruit blanc lue en boucle (puissance de deux, suivie d'un bloc recopié)
+    static const int NOISE_SIZE = 4096;
+
+    bool running;
+    int channels;
+    int frequency;
+
+    // Seule donnée partagée avec le jeu
+    std::atomic<int> targetSpeed;
+
+    // État de la synthèse, propre au thread audio
+    float speed;          // Vitesse lissée
+    float humPhase;       // Phases en cycles, dans [0, 1)
+    float clickPhase;
+    int noisePos;
+    float noise[NOISE_SIZE + BLOCK_FRAMES];
+    float block[BLOCK_FRAMES];  // Dernier bloc calculé (entre -1 et 1)
+    int blockPos;               // Trames du bloc déjà ajoutées au mixage
+
+    // Mesure de charge, écrite par le thread audio
+    std::atomic<Uint64> processCounter;  // Compteur de performance passé dans le callback
+    std::atomic<Uint64> processedFrames;
+
+    /*
+    Calcule le bloc de signal mono suivant dans block
+    */
+    void renderBlock();
+
+    /*
+    Callback de SDL_mixer (thread audio) : ajoute le vélo au mixage final
+    */
+    static void effect(int channel, void* stream, int len, void* udata);
+};
+
+#endif // BIKE_SYNTH_HPP
@@ -4,17 +4,18 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include "GameConstants.hpp"
+#include "inputaction.hpp"
 
 // Déclaration anticipée pour éviter la dépendance circulaire
 class Game;
 
 /*
 Classe Entity - Représente le vélo du joueur
-Cette classe gère toutes les fonctionnalités liées au vélo :
-- Mouvement entre les voies
-- Contrôle de la vitesse
+La position et la vitesse du vélo suivent les règles de la partie (Race) ;
+cette classe gère ce qui s'y ajoute dans le jeu :
+- Traduction des touches en actions
+- Sons des changements de voie et de vitesse
 - Rendu graphique
-- Détection de collision
 */
 class Entity {
     private:
@@ -24,21 +25,10 @@ class Entity {
     // Ressources graphiques
     SDL_Texture* texture;
     
-    // Positionnement et dimensions
-    int lane;       // Voie actuelle (0 à LANES-1)
-    int x, y;       // Position actuelle
-    int targetX;    // Position cible pour animation fluide
+    // Dimensions et position verticale (fixe)
+    int y;
     int width, height;
     
-    // Attributs de mouvement
-    int moveSpeed;     // Vitesse de déplacement horizontal
-    int verticalSpeed; // Vitesse verticale (non utilisée pour le vélo)
-    
-    // Attributs de vitesse pour le gameplay
-    int speed;      // Vitesse actuelle
-    int minSpeed;   // Vitesse minimale
-    int maxSpeed;   // Vitesse maximale
-    
     /*
     Charge la texture de l'entité
     */
@@ -47,8 +37,9 @@ class Entity {
     /*
     Affiche l'indicateur de vitesse
     Nouvelle méthode privée
+    drawX Position horizontale interpolée du vélo
     */
-    void renderSpeedIndicator();
+    void renderSpeedIndicator(int drawX);
 public:
     /*
     Constructeur
@@ -62,25 +53,24 @@ public:
     ~Entity();
     
     /*
-    Traite les événements d'entrée pour l'entité
+    Traduit un événement clavier en action du vélo
     event Événement SDL à traiter
+    action Reçoit l'action correspondante
+    return true si l'événement correspond à une action du vélo
      */
-    void handleEvents(SDL_Event& event);
+    static bool actionForEvent(const SDL_Event& event, InputAction& action);
     
     /*
-    Met à jour l'état de l'entité
+    Applique une action au vélo (changement de voie ou de vitesse)
+    action Action à appliquer (les autres actions sont ignorées)
     */
-    void update();
+    void applyAction(InputAction action);
     
     /*
     Affiche l'entité à l'écran
+    alpha Fraction du pas de simulation écoulée depuis la dernière mise à jour
     */
-    void render();
-    
-    /*
-    Réinitialise l'entité à son état initial
-    */
-    void reset();
+    void render(float alpha);
     
     /*
     Retourne la zone de collision de l'entité
@@ -113,6 +103,7 @@ public:
     return Vitesse actuelle
      */
     int getSpeed() const;
+    
 };
 
 #endif // ENTITY_HPP
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <SDL2/SDL.h>
+
+/*
+Classe FramePacer - Limiteur de framerate haute résolution
+Remplace SDL_Delay sur des millisecondes entières :
+- Échéances calculées avec SDL_GetPerformanceCounter (16,67 ms exactement à 60 FPS)
+- Sommeil grossier avec SDL_Delay, puis attente active pour la fin de l'intervalle
+- Échéances absolues : un retard ponctuel ne décale pas les images suivantes
+- Statistiques de dépassement (overshoot) par image
+*/
+class FramePacer {
+public:
+    /*
+    Constructeur
+    fps Fréquence cible en images par seconde (0 = pas de limite)
+    */
+    explicit FramePacer(int fps = 60);
+
+    /*
+    Change la fréquence cible
+    fps Images par seconde (0 = pas de limite)
+    */
+    void setTargetRate(int fps);
+    int getTargetRate() const { return targetRate; }
+
+    /*
+    Définit la marge finale passée en attente active plutôt qu'en sommeil
+    SDL_Delay dépasse couramment de 1 à 2 ms
+    ms Marge en millisecondes
+    */
+    void setSpinMargin(double ms);
+
+    /*
+    Repart d'une échéance à l'instant présent (après un chargement par exemple)
+    */
+    void reset();
+
+    /*
+    Attend l'échéance de la prochaine image et enregistre le dépassement
+    */
+    void waitForNextFrame();
+
+    // Statistiques de dépassement
+    Uint64 getFrameCount() const { return frames; }
+    Uint64 getLateFrameCount() const { return lateFrames; }
+    double getMeanOvershootMs() const;
+    double getMaxOvershootMs() const;
+
+    /*
+    Affiche un résumé des statistiques sur la sortie standard
+    */
+    void printStats() const;
+
+private:
+    int targetRate;
+    Uint64 frequency;    // Ticks du compteur haute résolution par seconde
+    Uint64 period;       // Durée d'une image en ticks
+    Uint64 spinMargin;   // Marge d'attente active en ticks
+    Uint64 deadline;     // Échéance de la prochaine image
+
+    Uint64 frames;           // Images attendues
+    Uint64 lateFrames;       // Images dont l'échéance était déjà dépassée
+    Uint64 totalOvershoot;   // Somme des dépassements en ticks
+    Uint64 maxOvershoot;     // Dépassement maximal en ticks
+};
+
+#endif // FRAME_PACER_HPP
@@ -19,9 +19,23 @@
    #include <memory>
    #include <string>
    #include "GameConstants.hpp"
-   #include "timer.hpp"
+   #include "random.hpp"
+   #include "texturecache.hpp"
+   #include "glyphatlas.hpp"
+   #include "framepacer.hpp"
+   #include "spritebatch.hpp"
+   #include "perfoverlay.hpp"
+   #include "assetloader.hpp"
+   #include "assetarchive.hpp"
    #include "entity.hpp"
    #include "object.hpp"
+   #include "race.hpp"
+   #include "trackconfig.hpp"
+   #include "inputaction.hpp"
+   #include "replay.hpp"
+   #include "musicengine.hpp"
+   #include "soundbank.hpp"
+   #include "bikesynth.hpp"
    
    // Déclarations anticipées
    class Menu;
@@ -52,8 +66,39 @@
        TTF_Font* font;
        TTF_Font* smallFont;
        SDL_Texture* roadTexture;
-       Mix_Music* menuMusic;
-       Mix_Music* gameMusic;
+       SDL_Texture* roadLayer;  // Route et lignes de voie pré-composées (cible de rendu)
+       float roadScroll;        // Décalage vertical de la route (0 à WINDOW_HEIGHT)
+       float prevRoadScroll;    // Décalage au pas précédent (interpolation)
+       MusicEngine music;       // Musiques décodées et mixées sur leur propre thread
+       SoundBank sounds;        // Effets sonores décodés au chargement
+       BikeSynth bikeSound;     // Pneus et chaîne synthétisés selon la vitesse
+       int audioBufferSize;     // Tampon du périphérique audio (trames)
+   
+       // Archive de ressources pré-décodées, projetée en mémoire si elle existe
+       AssetArchive assetArchive;
+   
+       // Contenu des fichiers ouverts depuis la mémoire : doit survivre aux
+       // polices et aux musiques, qui le lisent au fur et à mesure
+       std::vector<Uint8> fontData;
+       std::vector<Uint8> menuMusicData;
+       std::vector<Uint8> gameMusicData;
+       std::vector<Uint8> gameOverSoundData;
+   
+       // Compteur au lancement, pour mesurer le délai avant la première image interactive
+       Uint64 startupCounter;
+   
+       // File de rendu triée par couche et par texture
+       SpriteBatch spriteBatch;
+   
+       // Atlas de glyphes pour le texte du HUD (un par police)
+       GlyphAtlas fontAtlas;
+       GlyphAtlas smallFontAtlas;
+   
+       // Panneau de performances (F3 pour l'afficher, F4 pour figer et capturer)
+       PerfOverlay perfOverlay;
+   
+       // Cache des textures partagées (doit survivre au menu, au vélo et aux obstacles)
+       TextureCache textureCache;
    
        // État du jeu
        bool isRunning;
@@ -63,28 +108,97 @@
        Uint32 tutorialStartTime;
        bool tutorialsCompleted;
    
+       // Mode sans affichage (simulation pure pour les mesures de performance)
+       bool headless;
+   
+       // Horloge de simulation en millisecondes, avancée de SIM_STEP_MS à chaque pas
+       double simulationTime;
+       Uint32 simulationTick;  // Nombre de pas simulés (date des actions enregistrées)
+   
+       // Enregistrement des actions du joueur et rejeu
+       std::string recordPath;
+       ReplayRecorder recorder;
+       ReplayPlayer replay;
+       bool replayAutoRounds;  // Rejeu d'un enregistrement sans affichage (manches enchaînées)
+   
+       // Rendu sans limitation de framerate (la simulation reste à pas fixe)
+       bool uncappedRender;
+   
+       // Suivi des allocations par image et test du budget « zéro allocation »
+       bool allocationTracking;
+       bool allocationTest;
+       int allocationFrameState;  // État du jeu au début de l'image suivie
+       int playingFrames;         // Images consécutives dans l'état PLAYING
+       Uint64 budgetViolations;   // Images de PLAYING ayant alloué après la montée en charge
        // Entités du jeu
        std::unique_ptr<Menu> menu;
        std::unique_ptr<Entity> velo;
-       std::vector<std::unique_ptr<Object>> obstacles;
+       std::unique_ptr<Object> wall;  // Type d'obstacle (texture et dimensions partagées)
+       Race race;                     // Règles de la partie : vélo, obstacles et minuteur
+   
+       // Piste choisie au démarrage (nombre de voies)
+       const TrackConfig* track;
+   
+       // Aléatoire du jeu : un flux pour la partie, un pour le pilote automatique
+       // (les entrées ne modifient pas la suite des obstacles)
+       Uint64 seed;
+       Pcg32 rng;
+       Pcg32 autopilotRng;
    
        // Gestion du temps
-       Timer gameTimer;
-       Uint32 frameStart;
-       int frameTime;
-       Uint32 lastObstacleTime;
+       FramePacer framePacer;
+       bool vsync;  // Synchronisation verticale (remplace le limiteur)
    
+       /* Charge les ressources en parallèle en affichant l'écran de chargement
+          return true si le chargement est réussi, false sinon */
+       bool loadAssets();
+       
+       /* Ouvre les deux tailles de police et construit leurs atlas
+          return true si les polices sont prêtes, false sinon */
+       bool openFonts();
+       
+       /* Ouvre un flux sur une ressource chargée en mémoire
+          path Chemin de la ressource (clé dans l'archive)
+          data Contenu lu par le chargeur, utilisé si l'archive ne contient pas la ressource
+          return Flux de lecture (à fermer par l'appelant) */
+       SDL_RWops* openAssetRW(const char* path, const std::vector<Uint8>& data) const;
+       
+       /* Affiche la barre de progression du chargement
+          progress Avancement entre 0 et 1 */
+       void renderLoadingScreen(float progress);
+       
        /* Gère les événements utilisateur */
        void handleEvents();
        
-       /* Met à jour l'état du jeu */
+       /* Met à jour l'état du jeu d'un pas de simulation (SIM_DT) */
        void update();
        
-       /* Effectue le rendu graphique */
-       void render();
+       /* Effectue le rendu graphique
+          alpha Fraction du pas de simulation écoulée, pour l'interpolation */
+       void render(float alpha);
+       
+       /* Dessine les voies de la route
+          scrollOffset Décalage vertical des pointillés */
+       void renderLanes(int scrollOffset);
+       
+       /* Clé de la texture de route dans le cache : road.png pour la piste
+          par défaut, route unie pour les autres */
+       const char* getRoadTexturePath() const;
+       
+       /* Crée la route unie (gris et lignes des voies de la piste)
+          return Surface à libérer par l'appelant, nullptr en cas d'échec */
+       SDL_Surface* createPlainRoadSurface() const;
        
-       /* Dessine les voies de la route */
-       void renderLanes();
+       /* Pré-compose la route et les lignes de voie dans une texture cible
+          return true si la texture a été créée, false si le renderer ne le permet pas */
+       bool buildRoadLayer();
+       
+       /* Fait défiler la route d'un pas de simulation selon la vitesse du vélo */
+       void scrollRoad();
+       
+       /* Dessine la route défilante (deux copies de la couche pré-composée)
+          alpha Fraction du pas de simulation écoulée, pour l'interpolation */
+       void renderRoad(float alpha);
        
        /* Affiche le temps restant */
        void renderTimer();
@@ -98,20 +212,49 @@
        /* Affiche l'écran de fin de jeu */
        void renderGameOver();
        
-       /* Génère un obstacle */
-       void spawnObstacle();
-       
-       /* Vérifie les collisions */
-       void checkCollisions();
-       
-       /* Détecte une collision entre deux rectangles
-           a Premier rectangle
-           b Deuxième rectangle
-           return true si collision, false sinon */
-       bool checkCollision(const SDL_Rect& a, const SDL_Rect& b) const;
-       
        /* Avance à l'étape suivante du tutoriel */
        void advanceTutorial();
+   
+       /* Retourne le temps de simulation en millisecondes */
+       Uint32 getTicks() const;
+   
+       /* Horloge transmise aux règles de la partie */
+       static Uint32 gameClock(void* game);
+   
+       /* Démarre une manche sans affichage (tutoriel ignoré) */
+       void startHeadlessRound();
+   
+       /* Génère les entrées du pilote automatique en mode sans affichage */
+       void headlessInput();
+   
+       /* Enregistre puis applique une action du joueur
+          action Action à appliquer */
+       void performAction(InputAction action);
+   
+       /* Applique une action du joueur (vélo, tutoriel ou changement d'état)
+          action Action à appliquer */
+       void applyAction(InputAction action);
+   
+       /* Démarre l'enregistrement si un fichier a été demandé
+          flags Options du rejeu (ReplayFlags) */
+       void beginRecording(Uint32 flags);
+   
+       /* Termine l'enregistrement avec l'empreinte de l'état final */
+       void finishRecording();
+   
+       /* Calcule l'empreinte de l'état de la simulation
+          return Empreinte FNV-1a de l'état, du vélo, des obstacles et du générateur */
+       Uint64 computeStateHash() const;
+   
+       /* Démarre le suivi des allocations d'une image (étiquetée par l'état du jeu) */
+       void beginAllocationFrame();
+   
+       /* Termine le suivi des allocations d'une image et vérifie le budget de PLAYING
+          warmupFrames Images de PLAYING ignorées après l'entrée dans cet état */
+       void endAllocationFrame(int warmupFrames);
+   
+       /* Affiche le bilan des allocations par état et le résultat du test */
+       void reportAllocations();
     public:
        /* Constructeur */
        Game();
@@ -123,12 +266,70 @@
           return true si l'initialisation est réussie, false sinon */
        bool initialize();
        
+       /* Initialise le jeu sans fenêtre, renderer, polices ni audio
+          seed Graine du générateur aléatoire
+          return true si l'initialisation est réussie, false sinon */
+       bool initializeHeadless(Uint64 seed);
+       
        /* Lance la boucle principale du jeu */
        void run();
        
+       /* Exécute la simulation sans affichage ni limitation de framerate
+          et affiche le nombre de ticks par seconde
+          ticks Nombre de ticks à simuler */
+       void runHeadless(int ticks);
+       
+       /* Charge un rejeu et prépare la simulation sans affichage
+          path Fichier de rejeu
+          return true si le rejeu est prêt, false sinon */
+       bool initializeReplay(const std::string& path);
+       
+       /* Rejoue les actions enregistrées aussi vite que possible
+          return true si l'état final correspond à l'enregistrement */
+       bool runReplay();
+       
        /* Libère les ressources */
        void cleanup();
        
+       /* Active le rendu sans limitation de framerate
+          uncapped true pour rendre aussi vite que possible */
+       void setUncappedRender(bool uncapped) { uncappedRender = uncapped; }
+       
+       /* Change la fréquence d'images visée par le limiteur
+          fps Images par seconde */
+       void setTargetFps(int fps) { framePacer.setTargetRate(fps); }
+       
+       /* Définit la graine de la partie (à appeler avant initialize)
+          seed Graine : une même graine reproduit la même suite d'obstacles */
+       void setSeed(Uint64 seed);
+       
+       /* Choisit la piste (à appeler avant initialize)
+          config Piste parmi TRACK_CONFIGS */
+       void setTrack(const TrackConfig& config);
+       
+       /* Enregistre les actions de la partie (à appeler avant initialize)
+          path Fichier de rejeu écrit à la sortie */
+       void setRecordPath(const std::string& path) { recordPath = path; }
+       
+       /* Active le profilage par zones (trace écrite à la sortie et sur F12)
+          enabled true pour enregistrer les zones mesurées */
+       void setProfiling(bool enabled);
+       
+       /* Active le suivi des allocations par image
+          test true pour échouer si l'état PLAYING alloue après la montée en charge */
+       void setAllocationTracking(bool enabled, bool test);
+   
+       /* Indique si le test d'allocations a échoué */
+       bool allocationTestFailed() const { return allocationTest && budgetViolations > 0; }
+       
+       /* Active la synchronisation verticale (à appeler avant initialize)
+          enabled true pour créer le renderer avec SDL_RENDERER_PRESENTVSYNC */
+       void setVSync(bool enabled) { vsync = enabled; }
+       
+       /* Change la taille du tampon audio (à appeler avant initialize)
+          samples Trames par bloc : plus petit, les effets sortent plus tôt */
+       void setAudioBufferSize(int samples) { audioBufferSize = samples; }
+       
        /* Change l'état du jeu
           newState Nouvel état */
        void changeState(int newState);
@@ -137,12 +338,13 @@
        SDL_Renderer* getRenderer() const { return renderer; }
        TTF_Font* getFont() const { return font; }
        TTF_Font* getSmallFont() const { return smallFont; }
-       Mix_Music* getMenuMusic() const { return menuMusic; }
+       MusicEngine& getMusic() { return music; }
+       TextureCache& getTextureCache() { return textureCache; }
+       SpriteBatch& getSpriteBatch() { return spriteBatch; }
+       const TrackConfig& getTrack() const { return *track; }
+       Race& getRace() { return race; }
+       const Race& getRace() const { return race; }
    
-       /* Démarre le compte à rebours
-          seconds Durée en secondes */
-       void startTimer(int seconds);
-       
        /* Obtient le temps restant
           return Temps restant en secondes */
        int getRemainingTime() const;
@@ -151,17 +353,17 @@
           return true si le temps est écoulé, false sinon */
        bool isTimeUp() const;
        
-       /* Retourne la vitesse du vélo
-          return Vitesse actuelle du vélo */
-       int getVeloSpeed() const;
-       
        /* Charge les fichiers audio
           return true si le chargement est réussi, false sinon */
        bool loadAudio();
        
-       /* Joue une musique
-         music Pointeur vers la musique à jouer */
-       void playMusic(Mix_Music* music);
+       /* Joue une musique en boucle (fondu enchaîné depuis la musique en cours)
+         track Morceau à jouer, MusicEngine::TRACK_NONE pour le silence */
+       void playMusic(MusicEngine::Track track);
+       
+       /* Joue un effet sonore (sans effet en mode sans affichage)
+         sound Effet à jouer */
+       void playSound(SoundBank::Sound sound) { sounds.play(sound); }
    };
    
    #endif // GAME_HPP
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef GLYPH_ATLAS_HPP
+#define GLYPH_ATLAS_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <vector>
+#include "spritebatch.hpp"
+
+/*
+Classe GlyphAtlas - Rendu de texte à partir d'un atlas de glyphes
+Chaque glyphe d'une police est rastérisé une seule fois dans une texture :
+- Jeu de caractères Latin-1 (ASCII + accents français) plus quelques extras (œ, €, ’)
+- Les chaînes UTF-8 sont envoyées comme quads dans le SpriteBatch du jeu,
+  tout le texte d'une police est donc dessiné en un seul appel SDL_RenderGeometry
+- Le crénage (kerning) est pré-calculé pour toutes les paires de glyphes
+- Aucune allocation ni envoi de texture par image une fois l'atlas construit
+*/
+class GlyphAtlas {
+public:
+    GlyphAtlas();
+
+    /*
+    Destructeur - Libère la texture de l'atlas
+    */
+    ~GlyphAtlas();
+
+    /*
+    Rastérise les glyphes de la police et construit l'atlas
+    renderer Renderer utilisé pour créer la texture
+    font Police à rastériser (doit rester ouverte pour la durée de vie de l'atlas)
+    return true si l'atlas a été construit
+    */
+    bool build(SDL_Renderer* renderer, TTF_Font* font);
+
+    /*
+    Libère la texture et les métriques de l'atlas
+    */
+    void destroy();
+
+    /*
+    Ajoute une chaîne UTF-8 à la file de rendu
+    batch File de rendu
+    text Texte à dessiner
+    x, y Coin supérieur gauche du texte
+    color Couleur du texte
+    layer Couche de rendu
+    */
+    void drawText(SpriteBatch& batch, const char* text, int x, int y, SDL_Color color, int layer);
+
+    /*
+    Calcule les dimensions d'une chaîne UTF-8 sans la dessiner
+    text Texte à mesurer
+    w, h Dimensions en pixels (peuvent être nuls)
+    */
+    void measureText(const char* text, int* w, int* h) const;
+
+    /*
+    Vérifie si l'atlas est prêt à être utilisé
+    */
+    bool isReady() const { return texture != nullptr; }
+
+private:
+    struct Glyph {
+        Uint32 codepoint;
+        SDL_Rect src;  // Position dans l'atlas
+        int xOffset;   // Décalage horizontal par rapport au stylo
+        int advance;   // Avance du stylo après le glyphe
+    };
+
+    SDL_Texture* texture;
+    int atlasWidth, atlasHeight;
+    int lineHeight;
+
+    std::vector<Glyph> glyphs;
+    std::vector<Sint8> kerning;  // Table glyphs.size() x glyphs.size()
+    int latinIndex[256];         // Codepoint Latin-1 -> indice de glyphe (-1 si absent)
+    int fallbackIndex;           // Glyphe utilisé pour les caractères absents ('?')
+
+    /*
+    Retourne l'indice du glyphe d'un codepoint
+    */
+    int findGlyph(Uint32 codepoint) const;
+
+    /*
+    Décode le prochain codepoint d'une chaîne UTF-8 et avance le pointeur
+    */
+    static Uint32 nextCodepoint(const char*& text);
+};
+
+#endif // GLYPH_ATLAS_HPP
@@ -0,0 +1,17 @@
+#ifndef INPUT_ACTION_HPP
+#define INPUT_ACTION_HPP
+
+/* Actions de jeu produites par les entrées du joueur
+   Les touches sont traduites en actions avant d'agir sur le jeu, ce qui permet
+   de les enregistrer et de les rejouer (voir replay.hpp) */
+enum InputAction {
+    ACTION_MOVE_LEFT = 0,     /* Voie de gauche */
+    ACTION_MOVE_RIGHT = 1,    /* Voie de droite */
+    ACTION_SPEED_UP = 2,      /* Accélérer */
+    ACTION_SPEED_DOWN = 3,    /* Ralentir */
+    ACTION_STATE_MENU = 4,    /* Retour au menu */
+    ACTION_STATE_PLAYING = 5, /* Début d'une partie */
+    ACTION_COUNT = 6
+};
+
+#endif // INPUT_ACTION_HPP
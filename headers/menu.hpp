@@ -41,7 +41,7 @@ private:
     bool isMusicPlaying; // Suivre l'état de la musique
     
     // Variables pour les effets visuels
-    int highlightPulse;
+    float highlightPulse;  // Amplitude de la pulsation (0 à 30)
     int pulseDirection;
     
     // Texte à propos
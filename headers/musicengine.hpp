@@ -0,0 +1,164 @@
+#ifndef MUSIC_ENGINE_HPP
+#define MUSIC_ENGINE_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+Classe MusicEngine - Musique décodée et mixée sur un thread dédié
+SDL_mixer ne décode une musique qu'au fil de la lecture, dans le callback
+audio ; ici, tout le travail est fait hors du callback, par deux threads :
+- Au démarrage, le thread de décodage décode chaque morceau en entier (MP3
+  compris) au format du périphérique, sans bloquer le jeu ni le callback
+- Le thread de mixage boucle les morceaux sans blanc, gère les fondus
+  enchaînés et le volume, et remplit un tampon circulaire (un producteur, un
+  consommateur, positions atomiques, sans verrou)
+- Le tampon ne couvre que quelques blocs du périphérique : un changement de
+  morceau ou de volume s'entend quelques dizaines de millisecondes plus tard
+- Le callback branché par Mix_HookMusic ne fait que copier le tampon ; s'il
+  manque des échantillons, il complète par du silence et compte un sous-débit
+Seul le format 16 bits signé (MIX_DEFAULT_FORMAT) est pris en charge.
+*/
+class MusicEngine {
+public:
+    /* Morceaux connus du moteur */
+    enum Track {
+        TRACK_NONE = -1,  /* Silence */
+        TRACK_MENU = 0,   /* Musique du menu */
+        TRACK_GAME = 1,   /* Musique de la partie */
+        TRACK_COUNT = 2
+    };
+
+    // Blocs du périphérique couverts par le tampon circulaire (et périodes de réveil)
+    static const int RING_PERIODS = 4;
+
+    // Durée d'un fondu enchaîné entre deux morceaux
+    static const int CROSSFADE_MS = 800;
+
+    MusicEngine();
+
+    /*
+    Destructeur - Arrête le moteur
+    */
+    ~MusicEngine();
+
+    MusicEngine(const MusicEngine&) = delete;
+    MusicEngine& operator=(const MusicEngine&) = delete;
+
+    /*
+    Démarre les threads de décodage et de mixage et branche le callback sur
+    SDL_mixer (Mix_OpenAudio doit avoir réussi)
+    sources Un flux par morceau (nullptr si absent), refermés par le moteur ;
+            les données lues doivent rester valides jusqu'à la fin du décodage
+    bufferFrames Taille d'un bloc du périphérique (trames), pour dimensionner le tampon
+    return true si le moteur est démarré, false si le format audio n'est pas pris en charge
+    */
+    bool start(SDL_RWops* sources[TRACK_COUNT], int bufferFrames);
+
+    /*
+    Débranche le callback, arrête les threads et libère les morceaux
+    */
+    void stop();
+
+    /*
+    Demande un morceau : fondu enchaîné depuis le morceau en cours, sans effet
+    si ce morceau est déjà demandé (appel possible à chaque image)
+    track Morceau à jouer (TRACK_NONE pour un fondu vers le silence)
+    */
+    void play(Track track);
+
+    /*
+    Volume de la musique (remplace Mix_VolumeMusic, sans effet sur une musique branchée)
+    volume Entre 0 et MIX_MAX_VOLUME
+    */
+    void setVolume(int volume);
+    int getVolume() const { return volume.load(std::memory_order_relaxed); }
+
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    // Nombre de callbacks qui n'ont pas trouvé assez d'échantillons dans le tampon
+    Uint64 getUnderruns() const { return underruns.load(std::memory_order_relaxed); }
+
+    // Échantillons remplacés par du silence lors de ces sous-débits
+    Uint64 getMissingSamples() const { return missingSamples.load(std::memory_order_relaxed); }
+
+private:
+    // Période de réveil du thread de mixage (le tampon en couvre RING_PERIODS)
+    static const int FILL_PERIOD_MS = 10;
+
+    std::thread thread;             // Mixage
+    std::thread decoder;            // Décodage des morceaux au démarrage
+    std::atomic<bool> running;
+    std::atomic<int> requested;     // Morceau demandé par le jeu (Track)
+    std::atomic<int> volume;
+
+    // Tampon circulaire : positions en échantillons depuis le démarrage
+    std::vector<Sint16> ring;
+    size_t ringSamples;             // Taille du tampon (puissance de deux)
+    std::atomic<size_t> readPos;    // Écrite par le callback
+    std::atomic<size_t> writePos;   // Écrite par le thread
+    std::atomic<bool> streaming;    // Vrai dès que le tampon a été rempli une première fois
+
+    std::atomic<Uint64> underruns;
+    std::atomic<Uint64> missingSamples;
+
+    // Format du périphérique
+    int channels;
+    int frequency;
+
+    // Morceaux publiés par le thread de décodage ; ready passe à vrai une fois
+    // le morceau traité (chunks reste nul si le décodage a échoué)
+    std::atomic<Mix_Chunk*> chunks[TRACK_COUNT];
+    std::atomic<bool> ready[TRACK_COUNT];
+    SDL_RWops* pending[TRACK_COUNT];  // Flux à décoder (propres au thread de décodage)
+
+    // État du mixage, propre au thread de mixage
+    int current;             // Morceau en cours (Track)
+    size_t currentPos;       // Position dans le morceau en cours (échantillons)
+    int previous;            // Morceau qui s'éteint pendant le fondu
+    size_t previousPos;
+    int fadeFrames;          // Trames restantes du fondu (0 si aucun)
+    int fadeLength;          // Durée totale du fondu en trames
+    std::vector<int> mixBuffer;  // Somme des morceaux avant volume et saturation
+
+    /*
+    Boucle du thread de mixage : remplissage du tampon toutes les FILL_PERIOD_MS
+    */
+    void mixLoop();
+
+    /*
+    Boucle du thread de décodage : décode les morceaux en attente puis se termine
+    */
+    void decodeLoop();
+
+    /*
+    Décode un morceau en attente, le morceau demandé en priorité
+    return true si un morceau a été traité, false s'il n'en reste aucun
+    */
+    bool decodeNext();
+
+    /*
+    Mixe des trames (morceaux bouclés, fondu, volume) dans le tampon circulaire
+    frames Nombre de trames à produire (au plus la place libre)
+    */
+    void mix(int frames);
+
+    /*
+    Ajoute un morceau bouclé à mixBuffer
+    track Morceau, pos Position dans le morceau (avancée)
+    frames Nombre de trames, out Première trame de mixBuffer à compléter
+    fade 0 à plein volume, 1 en fondu entrant, -1 en fondu sortant
+    fadeStart Trames du fondu déjà jouées à la première trame
+    */
+    void accumulate(int track, size_t& pos, int frames, int fade, int fadeStart, int* out) const;
+
+    /*
+    Callback de SDL_mixer (thread audio) : copie le tampon dans le flux de sortie
+    */
+    static void hook(void* udata, Uint8* stream, int len);
+};
+
+#endif // MUSIC_ENGINE_HPP
@@ -4,31 +4,36 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include "GameConstants.hpp"
+#include "obstaclepool.hpp"
+#include "trackconfig.hpp"
 
 // Déclaration anticipée pour éviter la dépendance circulaire
 class Game;
 
 /*
-Classe Object - Représente les obstacles du jeu (uniquement des murs)
-Cette classe gère les obstacles qui descendent à l'écran :
-- Mouvement vertical
+Classe Object - Représente un type d'obstacle du jeu (uniquement des murs)
+Les positions de chaque obstacle sont rangées dans un ObstaclePool et
+placées par les règles de la partie (Race) ; cette classe regroupe ce qui est
+commun à l'affichage de tous les murs :
+- Texture partagée
+- Dimensions et vitesse de déplacement vertical
 - Rendu graphique
-- Détection de collision
 */
 class Object {
     private:
     // Référence au jeu parent
     Game* game;
-    
+
     // Ressources graphiques
     SDL_Texture* texture;
 
-    // Positionnement et dimensions
-    int lane;         
-    int x, y;
+    // Piste du jeu (positions des murs dans les voies)
+    const TrackConfig* track;
+
+    // Dimensions
     int width, height;
 
-    // Vitesse de déplacement vertical
+    // Vitesse de déplacement vertical (pixels/seconde)
     int speed;
     /*
     Charge la texture de l'obstacle
@@ -38,50 +43,26 @@ public:
     /*
     Constructeur
     game Pointeur vers l'instance du jeu
-    lane Voie sur laquelle placer l'obstacle
-    startY Position Y initiale
      */
-    Object(Game* game, int lane, int startY);
-    
+    Object(Game* game);
+
     /*
     Destructeur - Libère les ressources
     */
     ~Object();
-    
-    /*
-    Met à jour l'état de l'obstacle
-    Gère le mouvement vertical
-    */
-    void update();
-    
-    /*
-    Affiche l'obstacle à l'écran
-    */
-    void render();
-    
-    /*
-    Retourne la zone de collision de l'obstacle
-    return Rectangle de collision
-    */
-    SDL_Rect getCollisionBox() const;
-    
-    /*
-    Vérifie si l'obstacle est sorti de l'écran
-    return true si l'obstacle est complètement hors écran
-    */
-    bool isOffScreen() const;
-    
+
     /*
-    Retourne la voie sur laquelle se trouve l'obstacle
-    return Numéro de voie
+    Affiche tous les obstacles du stockage avec la texture de ce type
+    pool Stockage des obstacles
+    alpha Fraction du pas de simulation écoulée depuis la dernière mise à jour
     */
-    int getLane() const;
-    
+    void render(const ObstaclePool& pool, float alpha) const;
+
     /*
-    Retourne la position Y actuelle de l'obstacle
-    return Position Y
+    Retourne la vitesse de défilement propre de ce type d'obstacle
+    return Vitesse en pixels/seconde
     */
-    int getY() const;
+    int getSpeed() const { return speed; }
 };
 
-#endif // OBJECT_HPP
\ No newline at end of file
+#endif // OBJECT_HPP
@@ -0,0 +1,140 @@
+#ifndef OBSTACLE_POOL_HPP
+#define OBSTACLE_POOL_HPP
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "GameConstants.hpp"
+#include "trackconfig.hpp"
+
+/*
+Classe ObstaclePool - Stockage des obstacles en structure de tableaux (SoA)
+Chaque attribut est rangé dans un tableau contigu :
+- Mise à jour, élimination hors écran et collision sont de simples passes linéaires
+- Capacité fixe allouée une seule fois : les cases [size, capacity) forment la
+  liste des cases libres, un ajout réutilise la première d'entre elles
+- Suppression en O(1) par échange avec le dernier élément (l'ordre n'est pas conservé)
+- Aucune allocation en dehors de la construction et de setTrack, même pleine
+  (l'ajout est alors refusé)
+- Phase large : les indices sont aussi rangés par voie et triés par y, la collision
+  ne teste que les obstacles des voies du vélo proches de sa hauteur
+  (un obstacle est supposé ne pas déborder de sa voie, voir Race::spawnWave)
+*/
+class ObstaclePool {
+public:
+    // Capacité par défaut, largement au-dessus du nombre d'obstacles visibles
+    static const size_t DEFAULT_CAPACITY = 256;
+
+    /*
+    Constructeur
+    capacity Nombre maximal d'obstacles (mémoire allouée ici, une seule fois)
+    */
+    explicit ObstaclePool(size_t capacity = DEFAULT_CAPACITY);
+
+    /*
+    Supprime tous les obstacles (les cases redeviennent libres, la mémoire est conservée)
+    */
+    void clear();
+
+    /*
+    Adopte le découpage en voies d'une piste (vide le stockage et
+    redimensionne la phase large : à appeler hors de la boucle de jeu)
+    track Piste du jeu
+    */
+    void setTrack(const TrackConfig& track);
+
+    /*
+    Ajoute un obstacle dans la première case libre
+    lane Voie de l'obstacle (0 à laneCount - 1)
+    x Position horizontale
+    y Position verticale initiale
+    width, height Dimensions
+    speed Vitesse de défilement propre (pixels/seconde)
+    return false si le stockage est plein ou la voie invalide (l'obstacle est ignoré)
+    */
+    bool add(int lane, int x, float y, int width, int height, int speed);
+
+    /*
+    Supprime un obstacle en le remplaçant par le dernier
+    index Indice de l'obstacle
+    */
+    void remove(size_t index);
+
+    /*
+    Fait avancer tous les obstacles d'un pas de simulation (SIM_DT)
+    veloSpeed Vitesse actuelle du vélo
+    */
+    void update(int veloSpeed);
+
+    /*
+    Supprime les obstacles sortis par le bas de l'écran
+    return Nombre d'obstacles supprimés
+    */
+    size_t cullOffScreen();
+
+    /*
+    Teste la collision d'un rectangle avec les obstacles
+    Seules les voies recouvertes par le rectangle sont parcourues, à partir du
+    premier obstacle pouvant atteindre sa hauteur (recherche dichotomique)
+    box Rectangle à tester (boîte de collision du vélo)
+    return true si au moins un obstacle le chevauche
+    */
+    bool collides(const SDL_Rect& box) const;
+
+    /*
+    Même test par une passe linéaire sur tous les obstacles
+    (référence pour les mesures et les vérifications)
+    */
+    bool collidesLinear(const SDL_Rect& box) const;
+
+    /*
+    Retourne la boîte de collision d'un obstacle
+    (légèrement plus petite que l'obstacle pour une collision plus réaliste)
+    */
+    SDL_Rect getCollisionBox(size_t index) const;
+
+    // Accès en lecture aux tableaux
+    size_t size() const { return count; }
+    size_t capacity() const { return lanes.size(); }
+    bool empty() const { return count == 0; }
+    bool full() const { return count == lanes.size(); }
+    int getLane(size_t index) const { return lanes[index]; }
+    int getX(size_t index) const { return xs[index]; }
+    float getY(size_t index) const { return ys[index]; }
+    float getPrevY(size_t index) const { return prevYs[index]; }
+    int getWidth(size_t index) const { return widths[index]; }
+    int getHeight(size_t index) const { return heights[index]; }
+
+private:
+    // Marge retirée de chaque côté pour la boîte de collision
+    static const int COLLISION_PADDING = 5;
+
+    size_t count;  // Obstacles actifs (cases [0, count))
+
+    std::vector<int> lanes;
+    std::vector<int> xs;
+    std::vector<float> ys;
+    std::vector<float> prevYs;  // Position au pas précédent (interpolation)
+    std::vector<int> widths;
+    std::vector<int> heights;
+    std::vector<int> speeds;
+
+    // Phase large : indices de la voie l dans [l * capacité, l * capacité + laneCounts[l]),
+    // triés par y croissant
+    int laneCount;
+    int laneWidth;
+    std::vector<Uint32> laneIndices;
+    size_t laneCounts[MAX_TRACK_LANES];
+    int maxHeight;     // Plus grande hauteur ajoutée (bande de recherche en y)
+    bool mixedSpeeds;  // Vitesses propres différentes : l'ordre d'une voie peut changer
+
+    /* Premier rang de la voie dont l'obstacle a un y supérieur ou égal à y */
+    size_t lowerBound(int lane, float y) const;
+
+    /* Rang d'un obstacle dans sa voie */
+    size_t findInLane(size_t index) const;
+
+    /* Rétablit l'ordre des voies après un déplacement à vitesses différentes */
+    void sortLanes();
+};
+
+#endif // OBSTACLE_POOL_HPP
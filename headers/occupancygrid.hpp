@@ -0,0 +1,107 @@
+#ifndef OCCUPANCY_GRID_HPP
+#define OCCUPANCY_GRID_HPP
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "GameConstants.hpp"
+#include "trackconfig.hpp"
+
+/*
+Classe OccupancyGrid - Monde représenté par des rangées d'occupation des voies
+Stockage des murs de Race sur les pistes larges, à la place d'ObstaclePool :
+- Chaque rangée (ROW_HEIGHT pixels, la hauteur d'un mur) est un masque de bits,
+  un bit par voie : jusqu'à MAX_LANES voies, nombre choisi à l'exécution
+- Les rangées forment un tampon circulaire : le défilement déplace la tête et
+  vide la rangée qui réapparaît en haut, sans toucher aux autres
+- Un mur occupe toute la largeur de sa voie et la rangée qui contient son bord
+  supérieur (position arrondie à la rangée)
+- La collision est un ET entre le masque des voies du vélo et les rangées
+  recouvertes par sa hauteur
+Génération, défilement et collision coûtent O(rangées), quel que soit le nombre
+de murs ; aucun objet par obstacle.
+*/
+class OccupancyGrid {
+public:
+    static_assert(MAX_TRACK_LANES <= 64, "une rangée est un masque Uint64");
+
+    static constexpr int MAX_LANES = MAX_TRACK_LANES;
+    static constexpr int ROW_HEIGHT = WALL_HEIGHT;
+
+    /*
+    Constructeur
+    lanes Nombre de voies (1 à MAX_LANES)
+    laneWidth Largeur d'une voie en pixels
+    spawnHeight Hauteur au-dessus de l'écran où des murs peuvent apparaître (pixels)
+    */
+    OccupancyGrid(int lanes, int laneWidth, int spawnHeight);
+
+    /*
+    Vide toutes les rangées et remet le défilement à zéro
+    */
+    void clear();
+
+    /*
+    Place un mur
+    lane Voie du mur
+    y Position verticale du bord supérieur (écran)
+    return false si la position est hors de la grille
+    */
+    bool place(int lane, float y);
+
+    /*
+    Place plusieurs murs dans la même rangée
+    mask Voies occupées (bit i = voie i)
+    y Position verticale du bord supérieur (écran)
+    return false si la position est hors de la grille
+    */
+    bool placeMask(Uint64 mask, float y);
+
+    /*
+    Fait défiler le monde vers le bas
+    dy Distance en pixels (positive)
+    return Nombre de murs sortis par le bas de l'écran
+    */
+    int scroll(float dy);
+
+    /*
+    Teste si des voies sont occupées sur une bande verticale
+    laneMask Voies à tester (voir getLaneMask)
+    top, bottom Bande [top, bottom) en pixels d'écran
+    return true si une des rangées recouvertes occupe une de ces voies
+    */
+    bool collides(Uint64 laneMask, int top, int bottom) const;
+
+    /*
+    Retourne le masque des voies recouvertes par un intervalle horizontal
+    x, width Intervalle [x, x + width) en pixels
+    */
+    Uint64 getLaneMask(int x, int width) const;
+
+    /*
+    Accès aux rangées, de la plus haute (0) à la plus basse (getRowCount() - 1)
+    */
+    int getRowCount() const { return rowCount; }
+    int getFirstVisibleRow() const { return spawnRows > 0 ? spawnRows - 1 : 0; }  // Première rangée pouvant toucher l'écran
+    Uint64 getRow(int index) const { return rows[(head + index) & ringMask]; }
+    float getRowY(int index) const { return (index - spawnRows) * ROW_HEIGHT + offset; }
+
+    int getLanes() const { return lanes; }
+    int getLaneWidth() const { return laneWidth; }
+    Uint64 getAllLanes() const { return allLanes; }
+
+private:
+    int lanes;
+    int laneWidth;
+    Uint64 allLanes;    // Masque de toutes les voies
+    int spawnRows;      // Rangées au-dessus de l'écran
+    int rowCount;       // Rangées au-dessus de l'écran plus rangées visibles
+    Uint32 ringMask;    // Taille du tampon (puissance de deux) moins un
+    Uint32 head;        // Case physique de la rangée la plus haute
+    float offset;       // Décalage de défilement dans la rangée (0 à ROW_HEIGHT)
+    std::vector<Uint64> rows;
+
+    /* Rangée contenant une position verticale, -1 si elle est hors de la grille */
+    int rowAt(float y) const;
+};
+
+#endif // OCCUPANCY_GRID_HPP
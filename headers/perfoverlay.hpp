@@ -0,0 +1,77 @@
+#ifndef PERF_OVERLAY_HPP
+#define PERF_OVERLAY_HPP
+
+#include <SDL2/SDL.h>
+#include "spritebatch.hpp"
+#include "glyphatlas.hpp"
+
+/*
+Classe PerfOverlay - Affichage des performances en cours de partie
+Panneau superposé au HUD (F3) :
+- Graphe des temps d'image sur les 240 dernières images
+- Médiane (p50), 99e centile et maximum des temps d'image
+- Appels de rendu, obstacles actifs et mémoire des textures
+Le graphe est un ensemble de quads sans texture envoyés dans le SpriteBatch :
+il est dessiné avec le fond du panneau en un seul appel SDL_RenderGeometry.
+F4 fige le graphe et écrit l'historique dans un fichier pour capturer un à-coup.
+*/
+class PerfOverlay {
+public:
+    // Nombre d'images conservées dans l'historique
+    static const int HISTORY = 240;
+
+    /* Compteurs du jeu affichés dans le panneau */
+    struct Counters {
+        int drawCalls;       // Appels de rendu de l'image précédente
+        size_t obstacles;    // Obstacles actifs
+        size_t textureBytes; // Mémoire des textures du cache
+    };
+
+    PerfOverlay();
+
+    /*
+    Affiche ou masque le panneau
+    */
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+
+    /*
+    Enregistre la durée d'une image (ignorée quand le graphe est figé)
+    ms Durée en millisecondes
+    */
+    void addFrame(double ms);
+
+    /*
+    Fige ou relance le graphe ; en le figeant, écrit l'historique dans un fichier CSV
+    path Chemin du fichier de capture
+    */
+    void toggleCapture(const char* path);
+    bool isFrozen() const { return frozen; }
+
+    /*
+    Ajoute le panneau à la file de rendu (sans effet s'il est masqué)
+    batch File de rendu
+    atlas Atlas de glyphes utilisé pour le texte
+    counters Compteurs du jeu
+    */
+    void render(SpriteBatch& batch, GlyphAtlas& atlas, const Counters& counters);
+
+private:
+    bool visible;
+    bool frozen;
+
+    float frameTimes[HISTORY];  // Tampon circulaire des temps d'image (ms)
+    float sorted[HISTORY];      // Copie de travail pour les centiles
+    int head;                   // Prochaine case écrite
+    int count;                  // Nombre de cases valides
+
+    double overlayMs;           // Coût du panneau à l'image précédente
+    double frequency;           // Ticks du compteur haute résolution par ms
+
+    /*
+    Écrit l'historique (de la plus ancienne à la plus récente image) dans un fichier CSV
+    */
+    bool writeCapture(const char* path) const;
+};
+
+#endif // PERF_OVERLAY_HPP
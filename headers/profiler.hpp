@@ -0,0 +1,72 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <SDL2/SDL.h>
+
+/*
+Classe Profiler - Instrumentation par zones et export au format Chrome Trace
+Chaque zone mesurée (PROFILE_SCOPE) produit un événement :
+- Les événements sont écrits dans un tampon circulaire propre à chaque thread,
+  sans verrou (un seul écrivain par tampon)
+- Le fichier JSON produit s'ouvre dans chrome://tracing ou ui.perfetto.dev
+- Désactivé, une zone ne coûte qu'un test de booléen
+*/
+class Profiler {
+public:
+    // Nombre d'événements conservés par thread (les plus anciens sont écrasés)
+    static const Uint32 BUFFER_CAPACITY = 1 << 16;
+
+    /*
+    Active ou désactive l'enregistrement
+    */
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /*
+    Nomme le thread appelant dans la trace exportée
+    name Nom du thread (chaîne littérale)
+    */
+    static void setThreadName(const char* name);
+
+    /*
+    Enregistre une zone terminée pour le thread appelant
+    name Nom de la zone (chaîne littérale, conservée telle quelle)
+    start, end Compteurs SDL_GetPerformanceCounter de début et de fin
+    */
+    static void record(const char* name, Uint64 start, Uint64 end);
+
+    /*
+    Écrit le contenu des tampons au format Chrome Trace (JSON)
+    path Chemin du fichier
+    return true si le fichier a été écrit
+    */
+    static bool dumpChromeTrace(const char* path);
+};
+
+/*
+Classe ProfileScope - Mesure la durée de vie d'un bloc
+*/
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) :
+        name(name),
+        start(Profiler::isEnabled() ? SDL_GetPerformanceCounter() : 0) {}
+
+    ~ProfileScope() {
+        if (start != 0) Profiler::record(name, start, SDL_GetPerformanceCounter());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    Uint64 start;
+};
+
+// Mesure le bloc courant sous le nom donné
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+
+#endif // PROFILER_HPP
@@ -0,0 +1,145 @@
+#ifndef RACE_HPP
+#define RACE_HPP
+
+#include <SDL2/SDL.h>
+#include "GameConstants.hpp"
+#include "inputaction.hpp"
+#include "obstaclepool.hpp"
+#include "occupancygrid.hpp"
+#include "random.hpp"
+#include "timer.hpp"
+#include "trackconfig.hpp"
+
+/*
+Classe Race - Règles d'une partie (état PLAYING), sans rendu ni son
+Seule implémentation des règles d'un pas de simulation : Game et
+l'environnement vectorisé (VecEnv) jouent tous deux leurs parties par cette
+classe, sur n'importe quelle piste (TrackConfig) :
+- Action : changement de voie (position cible lue dans la table de la piste)
+  ou de vitesse entre BIKE_MIN_SPEED et BIKE_MAX_SPEED
+- Pas : glissement du vélo, avance des murs (vitesse propre de chaque mur plus
+  le bonus de vitesse du vélo), élimination hors écran, vague de murs toutes
+  les OBSTACLE_INTERVAL_MS, collision, puis fin du temps
+- Le temps est lu sur l'horloge de simulation fournie par setClock (celle de
+  Game, ou l'horloge propre de chaque partie de VecEnv)
+Les murs sont rangés dans un ObstaclePool (boîte exacte de chaque mur, rendu
+par Object) sur les pistes affichables ; à partir de GRID_LANES voies, ils le
+sont dans une OccupancyGrid (tous les murs ont la même vitesse propre : un
+défilement de la grille par pas, collision par masques de voies).
+Aucune allocation en dehors de la construction et de setTrack.
+*/
+class Race {
+public:
+    /* Issue d'un pas de simulation */
+    enum Outcome {
+        CRASHED = -1,  /* Collision avec un mur (défaite) */
+        RUNNING = 0,   /* La partie continue */
+        TIME_UP = 1    /* Fin du temps (victoire) */
+    };
+
+    /*
+    Constructeur
+    capacity Nombre maximal de murs simultanés
+    */
+    explicit Race(size_t capacity = ObstaclePool::DEFAULT_CAPACITY);
+
+    // Nombre de voies à partir duquel les murs sont rangés dans la grille
+    static const int GRID_LANES = 9;
+
+    /*
+    Adopte une piste (à appeler hors de la boucle de jeu, vide la partie)
+    track Piste, qui doit survivre à la partie
+    */
+    void setTrack(const TrackConfig& track);
+
+    /*
+    Choisit l'horloge de simulation lue par le minuteur et la génération des murs
+    clock Source de temps en millisecondes
+    userdata Paramètre transmis à clock
+    */
+    void setClock(Timer::Clock clock, void* userdata);
+
+    /*
+    Démarre une partie : vélo au milieu de la piste, aucun mur, minuteur à GAME_TIME
+    */
+    void start();
+
+    /*
+    Applique une action au vélo
+    action Action du joueur (les actions d'état sont ignorées)
+    return true si la voie ou la vitesse a changé
+    */
+    bool applyAction(InputAction action);
+
+    /*
+    Joue un pas de simulation (SIM_DT)
+    rng Générateur de la partie (tirages des vagues)
+    spawning false tant que le tutoriel retient les vagues de murs
+    return Issue du pas
+    */
+    Outcome tick(Pcg32& rng, bool spawning);
+
+    /*
+    Génère un mur isolé dans une voie tirée au hasard (tutoriel)
+    rng Générateur de la partie
+    */
+    void spawnSingleWall(Pcg32& rng);
+
+    /*
+    Génère une vague de murs, un par voie, à des hauteurs décalées
+    rng Générateur de la partie (un tirage par voie, même si le stockage est plein)
+    */
+    void spawnWave(Pcg32& rng);
+
+    /*
+    Retourne la boîte de collision du vélo
+    (légèrement plus petite que le vélo pour une collision plus réaliste)
+    */
+    SDL_Rect getBikeCollisionBox() const;
+
+    // Temps restant en secondes entières (0 une fois le temps écoulé)
+    int getRemainingTime() const { return timer.getRemainingTime(); }
+    bool isTimeUp() const { return timer.isTimeUp(); }
+
+    // Murs éliminés au dernier pas (le tutoriel avance quand un mur est passé)
+    size_t getCulled() const { return culled; }
+
+    // Accès en lecture
+    const TrackConfig& getTrack() const { return *track; }
+    bool usesGrid() const { return track->lanes >= GRID_LANES; }
+    const ObstaclePool& getWalls() const { return walls; }  // Vide si usesGrid()
+    const OccupancyGrid& getGrid() const { return grid; }   // Vide sinon
+    int getLane() const { return lane; }
+    float getX() const { return x; }
+    float getPrevX() const { return prevX; }
+    int getSpeed() const { return speed; }
+
+private:
+    // Marge retirée de chaque côté pour la boîte de collision du vélo
+    static const int BIKE_COLLISION_PADDING = 5;
+
+    const TrackConfig* track;
+    Timer::Clock clock;
+    void* clockData;
+    Timer timer;
+    ObstaclePool walls;
+    OccupancyGrid grid;
+
+    // Vélo
+    int lane;       // Voie actuelle (0 à track->lanes - 1)
+    float x;        // Position horizontale actuelle
+    float prevX;    // Position horizontale au pas précédent (interpolation)
+    int targetX;    // Position cible du glissement
+    int speed;      // Vitesse (BIKE_MIN_SPEED à BIKE_MAX_SPEED)
+
+    Uint32 lastSpawnTime;  // Horloge à la dernière vague
+    size_t culled;
+
+    /* Lit l'horloge de simulation (SDL_GetTicks si aucune n'est choisie) */
+    Uint32 now() const;
+
+    /* Ajoute un mur centré dans une voie */
+    void spawnWall(int wallLane, int startY);
+};
+
+#endif // RACE_HPP
@@ -0,0 +1,49 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <SDL2/SDL.h>
+
+/*
+Classe Pcg32 - Générateur pseudo-aléatoire PCG32 (XSH RR 64/32)
+Remplace rand() et std::random_device pour le jeu :
+- État de 16 octets possédé par le jeu : aucune dépendance à un état global
+- Graine explicite : une partie se reproduit à l'identique à partir de sa graine
+- Quelques instructions par tirage, sans appel système
+Plusieurs flux indépendants peuvent partager une graine (paramètre stream).
+*/
+class Pcg32 {
+public:
+    /*
+    Constructeur
+    seed Graine
+    stream Numéro de flux (deux flux d'une même graine sont indépendants)
+    */
+    explicit Pcg32(Uint64 seed = 0x853c49e6748fea9bULL, Uint64 stream = 0xda3e39cb94b95bdbULL);
+
+    /*
+    Réinitialise le générateur
+    */
+    void seed(Uint64 seed, Uint64 stream = 0xda3e39cb94b95bdbULL);
+
+    /*
+    Tire un entier uniforme sur 32 bits
+    */
+    Uint32 next();
+
+    /*
+    Tire un entier uniforme dans [0, bound) sans biais
+    bound Borne exclue (strictement positive)
+    */
+    Uint32 nextBelow(Uint32 bound);
+
+    /*
+    État courant (pour les empreintes d'état des rejeux)
+    */
+    Uint64 getState() const { return state; }
+
+private:
+    Uint64 state;
+    Uint64 increment;  // Toujours impair, détermine le flux
+};
+
+#endif // RANDOM_HPP
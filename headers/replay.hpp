@@ -0,0 +1,121 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+#include "inputaction.hpp"
+
+/*
+Fichiers de rejeu
+Une partie est entièrement déterminée par sa graine et par les actions du
+joueur, datées en pas de simulation. Format binaire compact :
+- En-tête : signature "VELOREP1", graine (64 bits), options (32 bits)
+- Actions : écart en pas depuis l'action précédente (entier variable, 7 bits
+  par octet) suivi du code de l'action (1 octet)
+- Fin : code REPLAY_END_MARKER après l'écart jusqu'au dernier pas, puis
+  l'empreinte de l'état final (64 bits)
+Les entiers fixes sont en petit-boutiste.
+*/
+
+/* Options d'un rejeu */
+enum ReplayFlags {
+    REPLAY_AUTO_ROUNDS = 1  /* Enregistré sans affichage : tutoriel ignoré, manches enchaînées */
+};
+
+// Nombre de voies de la piste, rangé dans les bits 8 à 15 des options (0 : piste par défaut)
+const int REPLAY_LANES_SHIFT = 8;
+
+const Uint8 REPLAY_END_MARKER = 0xFF;
+
+/*
+Ajoute des octets à une empreinte FNV-1a 64 bits
+hash Empreinte courante (FNV_OFFSET pour commencer)
+*/
+const Uint64 FNV_OFFSET = 0xcbf29ce484222325ULL;
+Uint64 fnv1a(Uint64 hash, const void* data, size_t size);
+
+/*
+Classe ReplayRecorder - Enregistre les actions d'une partie
+Les actions sont accumulées en mémoire et le fichier est écrit par finish()
+*/
+class ReplayRecorder {
+public:
+    ReplayRecorder();
+
+    /*
+    Démarre un enregistrement
+    path Fichier à écrire
+    seed Graine de la partie
+    flags Options (ReplayFlags)
+    */
+    void begin(const std::string& path, Uint64 seed, Uint32 flags);
+
+    bool isRecording() const { return recording; }
+
+    /*
+    Enregistre une action
+    tick Pas de simulation avant lequel l'action est appliquée
+    action Action du joueur
+    */
+    void record(Uint32 tick, InputAction action);
+
+    /*
+    Termine l'enregistrement et écrit le fichier
+    tick Dernier pas de simulation
+    stateHash Empreinte de l'état final
+    return true si le fichier a été écrit
+    */
+    bool finish(Uint32 tick, Uint64 stateHash);
+
+private:
+    bool recording;
+    std::string path;
+    std::vector<Uint8> data;
+    Uint32 lastTick;
+
+    void writeVarint(Uint32 value);
+};
+
+/*
+Classe ReplayPlayer - Relit un fichier de rejeu
+*/
+class ReplayPlayer {
+public:
+    ReplayPlayer();
+
+    /*
+    Charge un fichier de rejeu
+    return true si le fichier est valide
+    */
+    bool load(const std::string& path);
+
+    Uint64 getSeed() const { return seed; }
+    Uint32 getFlags() const { return flags; }
+    Uint32 getFinalTick() const { return finalTick; }
+    Uint64 getExpectedHash() const { return expectedHash; }
+    size_t getActionCount() const { return actions.size(); }
+
+    /*
+    Retourne la prochaine action prévue avant un pas de simulation
+    tick Pas de simulation courant
+    action Reçoit l'action
+    return true si une action est prévue avant ce pas
+    */
+    bool nextAction(Uint32 tick, InputAction& action);
+
+private:
+    struct Entry {
+        Uint32 tick;
+        Uint8 action;
+    };
+
+    Uint64 seed;
+    Uint32 flags;
+    Uint32 finalTick;
+    Uint64 expectedHash;
+    std::vector<Entry> actions;
+    size_t cursor;
+};
+
+#endif // REPLAY_HPP
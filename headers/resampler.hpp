@@ -0,0 +1,34 @@
+#ifndef RESAMPLER_HPP
+#define RESAMPLER_HPP
+
+#include <SDL2/SDL.h>
+
+/*
+Rééchantillonnage des images au chargement
+Filtre par zone (box/area) séparable, en deux passes :
+- Chaque pixel de destination est la moyenne des pixels source qu'il recouvre,
+  pondérée par la surface de recouvrement
+- Les couleurs sont prémultipliées par l'alpha pendant le filtrage
+  (pas de liseré sombre autour des zones transparentes)
+- Les quatre canaux d'un pixel sont traités ensemble en SSE2 si disponible
+Utilisé pour ramener les images à leur taille d'affichage, par le cache de
+textures, le chargeur parallèle et l'outil d'empaquetage.
+*/
+
+/*
+Crée une copie de l'image à la taille demandée (format SDL_PIXELFORMAT_RGBA32)
+source Image d'origine (n'importe quel format)
+width, height Taille de destination
+return Nouvelle surface (à libérer par l'appelant), ou nullptr en cas d'échec
+*/
+SDL_Surface* resampleSurface(SDL_Surface* source, int width, int height);
+
+/*
+Statistiques cumulées des rééchantillonnages (tous threads confondus)
+images Nombre d'images rééchantillonnées
+bytesBefore Taille RGBA des images d'origine
+bytesAfter Taille RGBA des images produites
+*/
+void getResampleStats(Uint64* images, Uint64* bytesBefore, Uint64* bytesAfter);
+
+#endif // RESAMPLER_HPP
@@ -0,0 +1,106 @@
+#ifndef SOUND_BANK_HPP
+#define SOUND_BANK_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <atomic>
+#include <vector>
+
+/*
+Classe SoundBank - Effets sonores décodés au chargement
+Tous les effets sont prêts à être mixés avant la première partie :
+- Un effet lu depuis un fichier est décodé une fois par Mix_LoadWAV_RW,
+  qui le convertit au format du périphérique (aucune conversion à la lecture)
+- Les effets sans fichier (collision, changement de voie, de vitesse) sont
+  synthétisés directement au format du périphérique
+- play() choisit un canal libre (ou le plus ancien) et ne fait aucune allocation
+La latence entre le déclenchement et la sortie est mesurée par un callback
+Mix_SetPostMix : un effet déclenché avant un bloc de mixage est compté dès la
+fin de ce bloc, plus la durée du bloc que le périphérique doit encore jouer.
+Seul le format 16 bits signé (MIX_DEFAULT_FORMAT) est pris en charge.
+*/
+class SoundBank {
+public:
+    /* Effets connus de la banque */
+    enum Sound {
+        SOUND_COLLISION = 0,    /* Choc contre un mur */
+        SOUND_GAME_OVER = 1,    /* Fin de partie (fichier game-over) */
+        SOUND_LANE_CHANGE = 2,  /* Changement de voie */
+        SOUND_SPEED_UP = 3,     /* Accélération */
+        SOUND_SPEED_DOWN = 4,   /* Ralentissement */
+        SOUND_COUNT = 5
+    };
+
+    // Canaux de mixage réservés aux effets (un par effet simultané)
+    static const int CHANNELS = 8;
+
+    SoundBank();
+
+    /*
+    Destructeur - Libère les effets
+    */
+    ~SoundBank();
+
+    SoundBank(const SoundBank&) = delete;
+    SoundBank& operator=(const SoundBank&) = delete;
+
+    /*
+    Décode ou synthétise tous les effets et branche la mesure de latence
+    (Mix_OpenAudio doit avoir réussi)
+    gameOver Flux du fichier de fin de partie (nullptr si absent), refermé par la banque ;
+             un effet synthétisé le remplace s'il est illisible
+    return true si la banque est prête, false si le format audio n'est pas pris en charge
+    */
+    bool load(SDL_RWops* gameOver);
+
+    /*
+    Débranche la mesure de latence, arrête les canaux et libère les effets
+    */
+    void unload();
+
+    /*
+    Joue un effet une fois (sans effet si la banque n'est pas chargée,
+    par exemple en mode sans affichage)
+    sound Effet à jouer
+    */
+    void play(Sound sound);
+
+    bool isLoaded() const { return loaded; }
+
+    // Nombre d'effets dont la sortie a été mesurée
+    Uint64 getLatencyCount() const { return latencyCount.load(std::memory_order_relaxed); }
+
+    // Latence moyenne et maximale entre le déclenchement et la sortie (ms)
+    double getAverageLatencyMs() const;
+    double getMaxLatencyMs() const;
+
+private:
+    bool loaded;
+    int channels;
+    int frequency;
+
+    Mix_Chunk* chunks[SOUND_COUNT];
+    std::vector<Sint16> synthesized[SOUND_COUNT];  // Échantillons des effets synthétisés
+
+    // Compteur au déclenchement de chaque canal (0 si aucune mesure en attente)
+    std::atomic<Uint64> pendingTrigger[CHANNELS];
+
+    // Mesures, écrites par le callback audio
+    std::atomic<Uint64> latencyCount;
+    std::atomic<Uint64> latencySumMicros;
+    std::atomic<Uint64> latencyMaxMicros;
+
+    /*
+    Synthétise un effet au format du périphérique
+    sound Effet à produire (tout sauf un effet lu depuis un fichier)
+    */
+    void synthesize(Sound sound);
+
+    /*
+    Callback de SDL_mixer (thread audio), appelé après le mixage de chaque
+    bloc : relève la latence des effets qui viennent d'y être mixés
+    */
+    static void postMix(void* udata, Uint8* stream, int len);
+};
+
+#endif // SOUND_BANK_HPP
@@ -0,0 +1,130 @@
+#ifndef SPRITE_BATCH_HPP
+#define SPRITE_BATCH_HPP
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+/* Couches de rendu, dessinées dans l'ordre croissant */
+enum RenderLayer {
+    LAYER_ROAD = 0,         /* Route */
+    LAYER_OBSTACLES = 1,    /* Murs */
+    LAYER_PLAYER = 2,       /* Vélo et sa jauge de vitesse */
+    LAYER_HUD = 3,          /* Fonds des éléments d'interface */
+    LAYER_HUD_TEXT = 4,     /* Texte de l'interface */
+    LAYER_OVERLAY = 5,      /* Voile de fin de partie */
+    LAYER_OVERLAY_TEXT = 6, /* Texte de fin de partie */
+    LAYER_DEBUG = 7,        /* Panneau de performances */
+    LAYER_DEBUG_TEXT = 8    /* Texte du panneau de performances */
+};
+
+/*
+Classe SpriteBatch - File de commandes de rendu regroupées par texture
+Les quads sont collectés pendant l'image puis, au moment du flush :
+- Triés par couche puis par texture (l'ordre de soumission est conservé à égalité)
+- Un quad qui recouvre un quad d'une autre texture soumis avant lui dans la
+  même couche passe dans une tranche supérieure : il reste dessiné par-dessus
+  (par exemple un contour de collision sur son sprite)
+- Chaque groupe (couche, texture) est envoyé en un seul appel SDL_RenderGeometry
+- Le nombre d'appels de rendu ne dépend plus du nombre d'obstacles
+Les rectangles pleins sont des quads sans texture.
+*/
+class SpriteBatch {
+public:
+    /*
+    Constructeur
+    capacity Nombre de quads pour lequel la mémoire est réservée
+    */
+    explicit SpriteBatch(size_t capacity = 1024);
+
+    /*
+    Démarre une nouvelle image (remise à zéro des compteurs de l'image)
+    */
+    void beginFrame();
+
+    /*
+    Termine l'image en cours et cumule ses compteurs dans les moyennes
+    */
+    void endFrame();
+
+    /*
+    Ajoute une copie de texture
+    texture Texture source
+    src Zone source (nullptr pour toute la texture)
+    dst Zone de destination
+    layer Couche de rendu
+    */
+    void draw(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst, int layer);
+
+    /*
+    Ajoute un rectangle plein
+    rect Rectangle à remplir
+    color Couleur (la transparence est prise en compte)
+    layer Couche de rendu
+    */
+    void fillRect(const SDL_Rect& rect, SDL_Color color, int layer);
+
+    /*
+    Ajoute le contour d'un rectangle (quatre rectangles d'un pixel)
+    */
+    void drawRect(const SDL_Rect& rect, SDL_Color color, int layer);
+
+    /*
+    Ajoute un quad aux coordonnées de texture normalisées (utilisé pour le texte)
+    */
+    void addQuad(SDL_Texture* texture, int layer,
+                 float x0, float y0, float x1, float y1,
+                 float u0, float v0, float u1, float v1, SDL_Color color);
+
+    /*
+    Trie et dessine toutes les commandes en attente puis vide la file
+    renderer Renderer cible
+    */
+    void flush(SDL_Renderer* renderer);
+
+    // Statistiques de l'image en cours
+    int getDrawCalls() const { return frameDrawCalls; }
+    int getVertexCount() const { return frameVertices; }
+
+    // Appels de rendu de la dernière image terminée
+    int getLastDrawCalls() const { return lastDrawCalls; }
+
+    /*
+    Affiche les moyennes par image sur la sortie standard
+    */
+    void printStats() const;
+
+private:
+    struct Quad {
+        SDL_Texture* texture;
+        int layer;
+        SDL_Vertex vertices[4];
+    };
+
+    std::vector<Quad> quads;
+    std::vector<Uint64> keys;               // Clés de tri (couche, tranche, texture, ordre)
+    std::vector<Uint8> bands;               // Tranche de chaque quad dans sa couche
+    std::vector<SDL_Texture*> textureIds;   // Textures rencontrées pendant l'image
+    std::vector<SDL_Vertex> vertexBuffer;   // Sommets triés
+    std::vector<int> indexBuffer;           // Motif d'indices 0,1,2,0,2,3,4,...
+
+    int frameDrawCalls;
+    int frameVertices;
+    int lastDrawCalls;
+    Uint64 frames;
+    Uint64 totalDrawCalls;
+    Uint64 totalVertices;
+    int maxDrawCalls;
+
+    /*
+    Retourne l'identifiant de tri d'une texture pour l'image en cours
+    */
+    Uint32 textureId(SDL_Texture* texture);
+
+    /*
+    Calcule la tranche de chaque quad : une de plus que le plus haut quad
+    d'une autre texture qu'il recouvre (la même pour une même texture)
+    */
+    void computeBands();
+};
+
+#endif // SPRITE_BATCH_HPP
@@ -0,0 +1,120 @@
+#ifndef TEXTURE_CACHE_HPP
+#define TEXTURE_CACHE_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+/*
+Classe TextureCache - Cache de textures partagées
+Chaque image n'est décodée et envoyée au GPU qu'une seule fois :
+- Les textures sont indexées par chemin de fichier
+- Chaque emprunteur (Menu, Entity, Object...) incrémente un compteur de références
+- La texture est détruite quand plus personne ne l'utilise
+- Des compteurs (hits, misses, octets résidents) permettent de vérifier
+  qu'aucun décodage n'a lieu pendant la partie
+- Une image dont la taille d'affichage est connue est rééchantillonnée à
+  cette taille avant l'envoi au GPU (voir resampler.hpp)
+*/
+class TextureCache {
+public:
+    // Fabrique de surface de secours utilisée si le fichier est introuvable
+    typedef std::function<SDL_Surface*()> FallbackFactory;
+
+    TextureCache();
+
+    /*
+    Destructeur - Libère toutes les textures restantes
+    */
+    ~TextureCache();
+
+    /*
+    Définit le renderer utilisé pour créer les textures
+    renderer Renderer SDL (peut être nul : aucune texture n'est alors créée)
+    */
+    void setRenderer(SDL_Renderer* renderer);
+
+    /*
+    Enregistre la taille d'affichage d'une image
+    Les chargements suivants de ce fichier produisent une texture à cette taille
+    path Chemin de l'image
+    width, height Taille d'affichage en pixels
+    */
+    void setTargetSize(const std::string& path, int width, int height);
+
+    /*
+    Retourne la taille d'affichage enregistrée pour une image
+    return true si une taille a été enregistrée
+    */
+    bool getTargetSize(const std::string& path, int& width, int& height) const;
+
+    /*
+    Emprunte la texture associée à un fichier, en la chargeant si nécessaire
+    path Chemin de l'image
+    fallback Fabrique de surface de secours si le chargement échoue (optionnelle)
+    return Texture partagée, ou nullptr en cas d'échec
+    */
+    SDL_Texture* acquire(const std::string& path, const FallbackFactory& fallback = nullptr);
+
+    /*
+    Crée la texture d'une image déjà décodée, sans l'emprunter
+    Le prochain acquire() du même chemin sera servi depuis le cache
+    path Chemin de l'image
+    surface Surface décodée (reste à la charge de l'appelant)
+    return true si la texture a été créée ou était déjà présente
+    */
+    bool preload(const std::string& path, SDL_Surface* surface);
+
+    /*
+    Rend une texture empruntée avec acquire()
+    La texture est détruite lorsque son compteur de références atteint zéro
+    path Chemin utilisé lors de l'emprunt
+    */
+    void release(const std::string& path);
+
+    /*
+    Détruit toutes les textures, même encore empruntées
+    À appeler avant la destruction du renderer
+    */
+    void clear();
+
+    // Statistiques
+    Uint64 getHits() const { return hits; }
+    Uint64 getMisses() const { return misses; }
+    size_t getBytesResident() const { return bytesResident; }
+    size_t getTextureCount() const { return entries.size(); }
+
+private:
+    struct Entry {
+        SDL_Texture* texture;
+        int refCount;
+        size_t bytes;  // Taille estimée de la texture en mémoire
+    };
+
+    struct Size {
+        int width;
+        int height;
+    };
+
+    SDL_Renderer* renderer;
+    std::unordered_map<std::string, Entry> entries;
+    std::unordered_map<std::string, Size> targetSizes;
+
+    Uint64 hits;          // Emprunts servis depuis le cache
+    Uint64 misses;        // Emprunts ayant nécessité un décodage
+    size_t bytesResident; // Mémoire occupée par les textures du cache
+
+    /*
+    Calcule la mémoire occupée par une texture
+    */
+    static size_t textureBytes(SDL_Texture* texture);
+
+    /*
+    Crée la texture d'une surface, rééchantillonnée si une taille d'affichage est enregistrée
+    */
+    SDL_Texture* createTexture(const std::string& path, SDL_Surface* surface);
+};
+
+#endif // TEXTURE_CACHE_HPP
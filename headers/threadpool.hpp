@@ -0,0 +1,95 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Classe ThreadPool - Groupe de threads de travail
+Les tâches soumises sont exécutées dans l'ordre d'arrivée par le premier
+thread libre :
+- Les threads sont créés une seule fois et attendent sur une variable de condition
+- wait() bloque jusqu'à ce que toutes les tâches soumises soient terminées
+- runJobs() répartit un lot de travaux fixes (fonction et données préparées
+  par l'appelant) sans aucune allocation, pour les boucles chaudes
+- Le destructeur termine les tâches en attente puis rejoint les threads
+*/
+class ThreadPool {
+public:
+    typedef std::function<void()> Task;
+
+    /* Travail d'un lot : aucune capture, rien à allouer */
+    struct Job {
+        void (*run)(void* data);
+        void* data;
+    };
+
+    /*
+    Constructeur
+    threads Nombre de threads (0 = nombre de cœurs moins un, au minimum 1)
+    name Nom des threads dans la trace du profileur (chaîne littérale)
+    */
+    explicit ThreadPool(unsigned int threads = 0, const char* name = "worker");
+
+    /*
+    Destructeur - Termine les tâches en attente et rejoint les threads
+    */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /*
+    Ajoute une tâche à la file
+    task Fonction exécutée sur un thread de travail
+    */
+    void submit(Task task);
+
+    /*
+    Attend la fin de toutes les tâches soumises
+    */
+    void wait();
+
+    /*
+    Exécute un lot de travaux et attend leur fin ; le thread appelant en prend
+    sa part. Aucune allocation : les travaux restent à la charge de l'appelant.
+    Un seul lot à la fois (les tâches soumises par submit() passent après)
+    jobs, count Travaux du lot
+    */
+    void runJobs(const Job* jobs, size_t count);
+
+    size_t size() const { return workers.size(); }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<Task> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;  // Signalée à chaque soumission
+    std::condition_variable allDone;        // Signalée quand la file est vide et les threads inactifs
+    unsigned int activeTasks;               // Tâches en cours d'exécution
+    bool stopping;
+
+    // Lot en cours (runJobs) : travaux [batchNext, batchSize) encore à prendre
+    const Job* batch;
+    size_t batchSize;
+    size_t batchNext;
+    size_t batchPending;                    // Travaux pris ou non encore terminés
+    std::condition_variable batchDone;
+
+    /*
+    Prend et exécute les travaux du lot jusqu'à ce qu'il n'en reste plus
+    lock Verrou tenu à l'appel et au retour
+    */
+    void drainBatch(std::unique_lock<std::mutex>& lock);
+
+    /*
+    Boucle d'un thread de travail
+    */
+    void workerLoop(const char* name);
+};
+
+#endif // THREAD_POOL_HPP
@@ -5,8 +5,13 @@
 
 class Timer {
 public:
+    // Source de temps en millisecondes (SDL_GetTicks par défaut)
+    typedef Uint32 (*Clock)(void* userdata);
+
     Timer();
     
+    void setClock(Clock clock, void* userdata);
+    
     void start(int seconds);
     void stop();
     void pause();
@@ -18,6 +23,11 @@ public:
     bool isStarted() const;
     
 private:
+    Clock clock;
+    void* clockData;
+
+    Uint32 now() const;
+
     int startTicks;      // Le temps au démarrage du timer
     int pausedTicks;     // Le temps lors de la mise en pause
     int totalDuration;   // Durée totale en millisecondes
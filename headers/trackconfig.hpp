@@ -0,0 +1,90 @@
+#ifndef TRACK_CONFIG_HPP
+#define TRACK_CONFIG_HPP
+
+#include <SDL2/SDL.h>
+#include "GameConstants.hpp"
+
+// Nombre maximal de voies d'une piste (taille des tables de positions) :
+// une rangée d'OccupancyGrid range les voies dans un masque Uint64
+const int MAX_TRACK_LANES = 64;
+
+/* Positions X, dans chaque voie, d'un objet centré */
+struct LaneTable {
+    int x[MAX_TRACK_LANES];
+};
+
+/*
+Structure TrackConfig - Piste choisie au démarrage
+Vue à l'exécution d'un TrackLayout : le jeu lit les positions dans les tables
+pré-calculées au lieu de les recalculer par des divisions à chaque déplacement
+*/
+struct TrackConfig {
+    int lanes;               // Nombre de voies
+    int width, height;       // Dimensions de la piste en pixels
+    int laneWidth;           // Largeur d'une voie
+    int wallWidth;           // Largeur des murs (réduite si la voie est plus étroite qu'un mur)
+    const LaneTable* bikeX;  // Position du vélo centré dans chaque voie
+    const LaneTable* wallX;  // Position d'un mur centré dans chaque voie
+};
+
+/*
+Modèle TrackLayout - Géométrie d'une piste calculée à la compilation
+Lanes Nombre de voies (1 à MAX_TRACK_LANES)
+Width, Height Résolution de la piste
+Le code spécialisé pour une piste utilise directement ces constantes (bornes de
+boucle connues, division par une constante) ; CONFIG en donne la vue à l'exécution.
+*/
+template <int Lanes, int Width = WINDOW_WIDTH, int Height = WINDOW_HEIGHT>
+struct TrackLayout {
+    static_assert(Lanes >= 1 && Lanes <= MAX_TRACK_LANES, "nombre de voies non pris en charge");
+
+    static constexpr int LANE_COUNT = Lanes;
+    static constexpr int LANE_W = Width / Lanes;
+    static constexpr int WALL_W = LANE_W * 9 / 10 < WALL_WIDTH ? LANE_W * 9 / 10 : WALL_WIDTH;
+
+    static constexpr LaneTable centres(int objectWidth) {
+        LaneTable table = {};
+        for (int lane = 0; lane < Lanes; lane++) {
+            table.x[lane] = lane * LANE_W + (LANE_W - objectWidth) / 2;
+        }
+        return table;
+    }
+
+    static constexpr LaneTable BIKE_X = centres(BIKE_WIDTH);
+    static constexpr LaneTable WALL_X = centres(WALL_W);
+
+    /* Voie contenant une position X (sans bornage) */
+    static constexpr int laneAt(int x) { return x / LANE_W; }
+
+    static constexpr TrackConfig CONFIG = {Lanes, Width, Height, LANE_W, WALL_W, &BIKE_X, &WALL_X};
+};
+
+// Piste par défaut : celle des constantes LANES et LANE_WIDTH
+typedef TrackLayout<LANES> DefaultTrack;
+static_assert(DefaultTrack::LANE_W == LANE_WIDTH && DefaultTrack::WALL_W == WALL_WIDTH,
+              "la piste par défaut doit reprendre les constantes du jeu");
+
+// Pistes proposées au démarrage (--lanes), puis pistes larges : une voie de
+// LANE_WIDTH pixels chacune, plus larges que la fenêtre, simulées sans rendu (VecEnv)
+const TrackConfig TRACK_CONFIGS[] = {
+    TrackLayout<3>::CONFIG,
+    TrackLayout<5>::CONFIG,
+    TrackLayout<8>::CONFIG,
+    TrackLayout<16, 16 * LANE_WIDTH>::CONFIG,
+    TrackLayout<32, 32 * LANE_WIDTH>::CONFIG,
+    TrackLayout<MAX_TRACK_LANES, MAX_TRACK_LANES * LANE_WIDTH>::CONFIG
+};
+
+/*
+Retourne la piste d'un nombre de voies donné
+lanes Nombre de voies
+return Piste correspondante, nullptr si aucune n'est proposée
+*/
+inline const TrackConfig* findTrackConfig(int lanes) {
+    for (const TrackConfig& config : TRACK_CONFIGS) {
+        if (config.lanes == lanes) return &config;
+    }
+    return nullptr;
+}
+
+#endif // TRACK_CONFIG_HPP
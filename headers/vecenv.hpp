@@ -0,0 +1,125 @@
+#ifndef VEC_ENV_HPP
+#define VEC_ENV_HPP
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "GameConstants.hpp"
+#include "race.hpp"
+#include "random.hpp"
+#include "threadpool.hpp"
+#include "trackconfig.hpp"
+
+/*
+Classe VecEnv - N parties simulées en parallèle, sans rendu, pour les agents
+Chaque partie est une Race, la classe qui porte aussi les règles de Game :
+l'environnement joue l'état PLAYING après le tutoriel, sur la piste choisie à
+la construction, sans copie des règles susceptible de s'en écarter.
+Chaque partie a sa propre horloge de simulation, avancée de SIM_STEP_MS par
+pas comme celle de Game ; le minuteur et les vagues de murs la lisent.
+step() répartit les parties par blocs contigus sur le groupe de threads
+(ThreadPool::runJobs), blocs préparés une fois pour toutes à la construction.
+Aucune allocation après la construction.
+
+Récompense d'un pas : SIM_DT par pas de simulation survécu, -1 en cas de
+collision, +1 à la fin du temps. Une partie terminée redémarre aussitôt
+(son générateur continue) : l'observation rendue est celle de la nouvelle partie.
+*/
+class VecEnv {
+public:
+    /* Actions d'un agent */
+    enum Action {
+        NOOP = 0,
+        LEFT = 1,
+        RIGHT = 2,
+        SPEED_UP = 3,
+        SPEED_DOWN = 4,
+        ACTION_COUNT = 5
+    };
+
+    // Murs conservés par partie (au plus une dizaine sont visibles à la fois)
+    static const int MAX_OBSTACLES = 32;
+
+    // Observation : grille d'occupation OBS_ROWS x voies de la piste (1 si un
+    // mur recouvre la case), puis la voie et la vitesse du vélo
+    static const int OBS_ROWS = 12;
+
+    /*
+    Constructeur
+    count Nombre de parties
+    pool Threads utilisés par step() (peut être partagé avec d'autres travaux)
+    ticksPerStep Pas de simulation (SIM_DT) joués par action
+    track Piste de toutes les parties (doit survivre à l'environnement)
+    */
+    VecEnv(size_t count, ThreadPool& pool, int ticksPerStep = 1, const TrackConfig& track = DefaultTrack::CONFIG);
+
+    /*
+    Démarre une nouvelle partie dans chaque environnement
+    seeds Une graine par partie (même flux que le générateur de Game)
+    */
+    void reset(const Uint64* seeds);
+
+    /*
+    Applique une action par partie puis avance chaque partie de ticksPerStep pas
+    actions Une action (VecEnv::Action) par partie
+    */
+    void step(const Uint8* actions);
+
+    size_t size() const { return count; }
+
+    // Taille d'une ligne d'observation : OBS_ROWS * voies + 2
+    int getObservationSize() const { return obsSize; }
+
+    // Résultats du dernier reset() ou step(), une ligne par partie
+    const Uint8* getObservations() const { return observations.data(); }
+    const float* getRewards() const { return rewards.data(); }
+    const Uint8* getDones() const { return dones.data(); }
+    const Uint8* getWins() const { return wins.data(); }
+
+private:
+    // Nombre minimal de parties par bloc : en dessous, la synchronisation coûte plus qu'elle ne rapporte
+    static const size_t MIN_BLOCK = 256;
+
+    size_t count;
+    ThreadPool& pool;
+    int ticksPerStep;
+    const TrackConfig* track;
+    int obsSize;
+
+    // Parties, leur horloge de simulation (ms) et leur générateur
+    std::vector<double> clocks;
+    std::vector<Race> races;
+    std::vector<Pcg32> rngs;
+
+    // Blocs de step() : parties [begin, end) de chacun, et les travaux du lot
+    struct Block {
+        VecEnv* env;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<Block> blocks;
+    std::vector<ThreadPool::Job> jobs;
+    const Uint8* stepActions;  // Actions du step() en cours, lues par les blocs
+
+    // Sorties
+    std::vector<Uint8> observations;
+    std::vector<float> rewards;
+    std::vector<Uint8> dones;
+    std::vector<Uint8> wins;
+
+    /* Remet une partie à son état initial (le générateur n'est pas touché) */
+    void resetEnv(size_t env);
+
+    /* Avance les parties [begin, end) */
+    void stepRange(size_t begin, size_t end, const Uint8* actions);
+
+    /* Travail d'un bloc (ThreadPool::Job) */
+    static void runBlock(void* block);
+
+    /* Écrit l'observation d'une partie */
+    void observe(size_t env);
+
+    /* Horloge d'une partie, transmise à sa Race */
+    static Uint32 envClock(void* clock);
+};
+
+#endif // VEC_ENV_HPP
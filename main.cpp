@@ -1,19 +1,128 @@
 #include "./headers/game.hpp"
+#include "./headers/alloccounter.hpp"
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 
 int main(int argc, char* argv[]) {
+    // Options de la ligne de commande
+    // --headless : simulation sans fenêtre pour mesurer les performances
+    // --ticks N  : nombre de ticks simulés en mode sans affichage
+    // --seed N   : graine du générateur aléatoire (par défaut 1 sans affichage, l'heure sinon)
+    // --uncapped : rendu sans limitation de framerate
+    // --fps N    : fréquence d'images visée
+    // --vsync    : synchronisation verticale au lieu du limiteur
+    // --profile  : trace Chrome/Perfetto écrite à la sortie (et sur F12)
+    // --alloc-track : bilan des allocations par image et par état
+    // --alloc-test  : échoue si l'état PLAYING alloue après la montée en charge
+    // --record F : enregistre la graine et les actions de la partie dans F
+    // --replay F : rejoue F sans affichage et vérifie l'état final
+    // --lanes N  : piste à N voies (3, 5 ou 8)
+    // --audio-buffer N : tampon audio de N trames (latence des effets sonores)
+    bool headless = false;
+    bool profile = false;
+    bool allocTrack = false;
+    bool allocTest = false;
+    bool uncapped = false;
+    bool vsync = false;
+    int fps = FPS;
+    int ticks = 100000;
+    Uint64 seed = 1;
+    bool seedGiven = false;
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    int lanes = LANES;
+    int audioBuffer = AUDIO_BUFFER_SAMPLES;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--uncapped") == 0) {
+            uncapped = true;
+        } else if (std::strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+        } else if (std::strcmp(argv[i], "--alloc-track") == 0) {
+            allocTrack = true;
+        } else if (std::strcmp(argv[i], "--alloc-test") == 0) {
+            allocTest = true;
+        } else if (std::strcmp(argv[i], "--vsync") == 0) {
+            vsync = true;
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            fps = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+            seedGiven = true;
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--lanes") == 0 && i + 1 < argc) {
+            lanes = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--audio-buffer") == 0 && i + 1 < argc) {
+            audioBuffer = std::atoi(argv[++i]);
+        }
+    }
+
+    // Les fonctions mémoire de SDL doivent être remplacées avant sa première allocation
+    if (allocTrack || allocTest) {
+        AllocCounter::installSDLHooks();
+    }
+
+    // Les pistes larges ne tiennent pas dans la fenêtre : réservées à VecEnv
+    const TrackConfig* track = findTrackConfig(lanes);
+    if (!track || track->width > WINDOW_WIDTH) {
+        std::cerr << "Unsupported lane count " << lanes << " (available: 3, 5, 8)" << std::endl;
+        return 1;
+    }
+
+    // Tampon audio : puissance de deux raisonnable (SDL l'arrondit sinon en silence)
+    if (audioBuffer < AUDIO_BUFFER_MIN || audioBuffer > AUDIO_BUFFER_MAX || (audioBuffer & (audioBuffer - 1)) != 0) {
+        std::cerr << "Invalid --audio-buffer " << audioBuffer << " (expected a power of two from "
+                  << AUDIO_BUFFER_MIN << " to " << AUDIO_BUFFER_MAX << ")" << std::endl;
+        return 1;
+    }
+
     // Create game instance
     Game game;
-    
+    game.setTrack(*track);
+    game.setProfiling(profile);
+    game.setAllocationTracking(allocTrack, allocTest);
+
+    if (replayPath) {
+        if (!game.initializeReplay(replayPath)) {
+            std::cerr << "Failed to load the replay!" << std::endl;
+            return 1;
+        }
+        return game.runReplay() ? 0 : 1;
+    }
+
+    if (recordPath) game.setRecordPath(recordPath);
+
+    if (headless) {
+        if (!game.initializeHeadless(seed)) {
+            std::cerr << "Failed to initialize the headless simulation!" << std::endl;
+            return 1;
+        }
+        game.runHeadless(ticks);
+        return game.allocationTestFailed() ? 1 : 0;
+    }
+
     // Initialize the game
+    game.setVSync(vsync);
+    game.setAudioBufferSize(audioBuffer);
+    game.setTargetFps(fps);
+    game.setSeed(seedGiven ? seed : static_cast<Uint64>(std::time(nullptr)));
     if (!game.initialize()) {
         std::cerr << "Failed to initialize the game!" << std::endl;
         return 1;
     }
       //so if
-      
+    game.setUncappedRender(uncapped);
+
     // Run the game
     game.run();
-    
-    return 0;
-}
\ No newline at end of file
+
+    return game.allocationTestFailed() ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+#include "../headers/alloccounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+/*
+Comptage des allocations
+Les totaux sont atomiques (les threads de chargement, de musique et le thread
+audio allouent aussi) avec un ordre relâché : seul le total compte, pas l'ordre
+entre threads. Chaque thread tient en plus ses propres compteurs (thread_local) :
+le suivi par image en fait la différence entre le début et la fin de l'image,
+et ne relève donc que les allocations du thread qui l'appelle (la boucle principale).
+*/
+
+namespace {
+    std::atomic<Uint64> allocationCount(0);
+    std::atomic<Uint64> allocationBytes(0);
+
+    // Compteurs du thread courant (initialisation constante, sans allocation)
+    thread_local Uint64 threadCount = 0;
+    thread_local Uint64 threadBytes = 0;
+
+    inline void countAllocation(size_t size) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocationBytes.fetch_add(size, std::memory_order_relaxed);
+        threadCount++;
+        threadBytes += size;
+    }
+
+    // Fonctions mémoire de SDL d'origine, appelées par les versions qui comptent
+    SDL_malloc_func sdlMalloc = nullptr;
+    SDL_calloc_func sdlCalloc = nullptr;
+    SDL_realloc_func sdlRealloc = nullptr;
+    SDL_free_func sdlFree = nullptr;
+
+    void* SDLCALL countedSDLMalloc(size_t size) {
+        countAllocation(size);
+        return sdlMalloc(size);
+    }
+
+    void* SDLCALL countedSDLCalloc(size_t count, size_t size) {
+        countAllocation(count * size);
+        return sdlCalloc(count, size);
+    }
+
+    void* SDLCALL countedSDLRealloc(void* memory, size_t size) {
+        countAllocation(size);
+        return sdlRealloc(memory, size);
+    }
+
+    void SDLCALL countedSDLFree(void* memory) {
+        sdlFree(memory);
+    }
+
+    // Suivi par image
+    AllocCounter::TagStats tagStats[AllocCounter::MAX_TAGS] = {};
+    int frameTag = -1;
+    Uint64 frameStartCount = 0;
+    Uint64 frameStartBytes = 0;
+}
+
+#ifndef NDEBUG
+
+namespace {
+    void* countedAlloc(std::size_t size) {
+        countAllocation(size);
+        void* memory = std::malloc(size ? size : 1);
+        if (!memory) throw std::bad_alloc();
+        return memory;
+    }
+}
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+bool AllocCounter::isEnabled() { return true; }
+
+#else
+
+bool AllocCounter::isEnabled() { return false; }
+
+#endif
+
+bool AllocCounter::installSDLHooks() {
+    if (sdlMalloc) return true;
+    SDL_GetMemoryFunctions(&sdlMalloc, &sdlCalloc, &sdlRealloc, &sdlFree);
+    if (SDL_SetMemoryFunctions(countedSDLMalloc, countedSDLCalloc, countedSDLRealloc, countedSDLFree) != 0) {
+        std::cerr << "Failed to install SDL memory hooks: " << SDL_GetError() << std::endl;
+        sdlMalloc = nullptr;
+        return false;
+    }
+    return true;
+}
+
+Uint64 AllocCounter::getCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+Uint64 AllocCounter::getBytes() {
+    return allocationBytes.load(std::memory_order_relaxed);
+}
+
+void AllocCounter::beginFrame(int tag) {
+    frameTag = (tag >= 0 && tag < MAX_TAGS) ? tag : -1;
+    frameStartCount = threadCount;
+    frameStartBytes = threadBytes;
+}
+
+Uint64 AllocCounter::endFrame() {
+    Uint64 allocations = threadCount - frameStartCount;
+    if (frameTag < 0) return allocations;
+
+    TagStats& stats = tagStats[frameTag];
+    stats.frames++;
+    stats.allocations += allocations;
+    stats.bytes += threadBytes - frameStartBytes;
+    if (allocations > 0) stats.framesWithAllocations++;
+    if (allocations > stats.maxAllocations) stats.maxAllocations = allocations;
+    frameTag = -1;
+    return allocations;
+}
+
+const AllocCounter::TagStats& AllocCounter::getTagStats(int tag) {
+    static const TagStats empty = {};
+    return (tag >= 0 && tag < MAX_TAGS) ? tagStats[tag] : empty;
+}
+
+void AllocCounter::printStats(const char* const names[], int count) {
+    for (int tag = 0; tag < count && tag < MAX_TAGS; tag++) {
+        const TagStats& stats = tagStats[tag];
+        if (stats.frames == 0) continue;
+        std::cout << "Allocations [" << names[tag] << "]: "
+                  << static_cast<double>(stats.allocations) / stats.frames << "/frame ("
+                  << static_cast<double>(stats.bytes) / stats.frames << " bytes/frame, max "
+                  << stats.maxAllocations << "), " << stats.framesWithAllocations << " of "
+                  << stats.frames << " frames allocated" << std::endl;
+    }
+}
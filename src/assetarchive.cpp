@@ -0,0 +1,165 @@
+#include "../headers/assetarchive.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+Archive projetée
+L'index est trié par nom à la création : la recherche est une dichotomie
+directement dans la projection, sans structure intermédiaire.
+*/
+
+namespace {
+    bool entryLess(const PakEntry& entry, const std::string& name) {
+        return std::strncmp(entry.name, name.c_str(), sizeof(entry.name)) < 0;
+    }
+}
+
+AssetArchive::AssetArchive() :
+    base(nullptr),
+    mappedSize(0),
+    entries(nullptr),
+    entryCount(0)
+#ifdef _WIN32
+    , fileHandle(nullptr),
+    mappingHandle(nullptr)
+#else
+    , fileDescriptor(-1)
+#endif
+{}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const char* path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    fileHandle = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(PakHeader))) {
+        close();
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        close();
+        return false;
+    }
+    mappingHandle = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        close();
+        return false;
+    }
+    base = static_cast<const Uint8*>(view);
+    mappedSize = static_cast<size_t>(size.QuadPart);
+#else
+    fileDescriptor = ::open(path, O_RDONLY);
+    if (fileDescriptor < 0) return false;
+
+    struct stat info;
+    if (fstat(fileDescriptor, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(PakHeader))) {
+        close();
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (view == MAP_FAILED) {
+        close();
+        return false;
+    }
+    base = static_cast<const Uint8*>(view);
+    mappedSize = static_cast<size_t>(info.st_size);
+#endif
+
+    const PakHeader* header = reinterpret_cast<const PakHeader*>(base);
+    entryCount = header->entryCount;
+    entries = reinterpret_cast<const PakEntry*>(base + sizeof(PakHeader));
+
+    if (!validate()) {
+        std::cerr << "Archive de ressources invalide: " << path << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void AssetArchive::close() {
+#ifdef _WIN32
+    if (base) UnmapViewOfFile(base);
+    if (mappingHandle) CloseHandle(static_cast<HANDLE>(mappingHandle));
+    if (fileHandle) CloseHandle(static_cast<HANDLE>(fileHandle));
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+#else
+    if (base) munmap(const_cast<Uint8*>(base), mappedSize);
+    if (fileDescriptor >= 0) ::close(fileDescriptor);
+    fileDescriptor = -1;
+#endif
+    base = nullptr;
+    mappedSize = 0;
+    entries = nullptr;
+    entryCount = 0;
+}
+
+bool AssetArchive::validate() const {
+    const PakHeader* header = reinterpret_cast<const PakHeader*>(base);
+    if (std::memcmp(header->magic, PAK_MAGIC, sizeof(PAK_MAGIC)) != 0) return false;
+
+    Uint64 indexEnd = sizeof(PakHeader) + static_cast<Uint64>(entryCount) * sizeof(PakEntry);
+    if (indexEnd > mappedSize) return false;
+
+    for (Uint32 i = 0; i < entryCount; i++) {
+        const PakEntry& entry = entries[i];
+        if (entry.name[sizeof(entry.name) - 1] != '\0') return false;
+        // Décalage vérifié avant la soustraction (sinon elle déborde)
+        if (entry.offset < indexEnd || entry.offset > mappedSize || entry.size > mappedSize - entry.offset) return false;
+        if (entry.type == PAK_IMAGE) {
+            if (entry.pitch < entry.width * 4 || static_cast<Uint64>(entry.pitch) * entry.height > entry.size) {
+                return false;
+            }
+        } else if (entry.type != PAK_BLOB) {
+            return false;
+        }
+        if (i > 0 && std::strcmp(entries[i - 1].name, entry.name) >= 0) return false;
+    }
+    return true;
+}
+
+const PakEntry* AssetArchive::find(const std::string& name) const {
+    if (!base) return nullptr;
+    const PakEntry* end = entries + entryCount;
+    const PakEntry* it = std::lower_bound(entries, end, name, entryLess);
+    if (it == end || name != it->name) return nullptr;
+    return it;
+}
+
+SDL_Surface* AssetArchive::createSurface(const PakEntry& entry) const {
+    if (!base || entry.type != PAK_IMAGE) return nullptr;
+    // SDL ne modifie pas les pixels d'une surface utilisée comme source
+    void* pixels = const_cast<Uint8*>(base + entry.offset);
+    return SDL_CreateRGBSurfaceWithFormatFrom(pixels, static_cast<int>(entry.width), static_cast<int>(entry.height),
+                                              32, static_cast<int>(entry.pitch), SDL_PIXELFORMAT_RGBA32);
+}
+
+SDL_RWops* AssetArchive::openRW(const PakEntry& entry) const {
+    if (!base) return nullptr;
+    return SDL_RWFromConstMem(base + entry.offset, static_cast<int>(entry.size));
+}
@@ -0,0 +1,119 @@
+#include "../headers/assetloader.hpp"
+#include "../headers/profiler.hpp"
+#include "../headers/resampler.hpp"
+#include <SDL2/SDL_image.h>
+#include <iostream>
+
+/*
+Chargement parallèle
+Chaque demande devient une tâche du ThreadPool. Le résultat est déposé sous
+verrou dans une file (images) ou une table (fichiers) que le thread de rendu
+consulte entre deux images de l'écran de chargement. Les erreurs sont
+enregistrées par les threads de travail et affichées sur le thread principal.
+*/
+
+AssetLoader::AssetLoader(ThreadPool& pool) :
+    pool(pool),
+    surfaceFormat(SDL_PIXELFORMAT_UNKNOWN),
+    total(0),
+    completed(0) {}
+
+AssetLoader::~AssetLoader() {
+    // Les tâches référencent le chargeur : il doit leur survivre
+    pool.wait();
+    for (auto& image : decoded) {
+        SDL_FreeSurface(image.surface);
+    }
+}
+
+void AssetLoader::loadImage(const std::string& path, int width, int height) {
+    total++;
+    pool.submit([this, path, width, height]() {
+        PROFILE_SCOPE("decode image");
+        SDL_Surface* surface = IMG_Load(path.c_str());
+        if (surface && width > 0 && height > 0 && (surface->w != width || surface->h != height)) {
+            PROFILE_SCOPE("resample image");
+            SDL_Surface* resized = resampleSurface(surface, width, height);
+            if (resized) {
+                SDL_FreeSurface(surface);
+                surface = resized;
+            }
+        }
+        if (surface && surfaceFormat != SDL_PIXELFORMAT_UNKNOWN && surface->format->format != surfaceFormat) {
+            // Conversion sur ce thread : SDL_CreateTextureFromSurface n'aura plus qu'à copier
+            SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, surfaceFormat, 0);
+            if (converted) {
+                SDL_FreeSurface(surface);
+                surface = converted;
+            }
+        }
+
+        // En cas d'échec, le cache retentera le chargement et utilisera sa texture de secours
+        if (surface) {
+            std::lock_guard<std::mutex> lock(mutex);
+            decoded.push_back({path, surface});
+        }
+        completed++;
+    });
+}
+
+void AssetLoader::loadFile(const std::string& path) {
+    total++;
+    pool.submit([this, path]() {
+        PROFILE_SCOPE("read file");
+        LoadedFile file;
+        file.ok = false;
+
+        SDL_RWops* rw = SDL_RWFromFile(path.c_str(), "rb");
+        if (rw) {
+            Sint64 size = SDL_RWsize(rw);
+            if (size > 0) {
+                file.data.resize(static_cast<size_t>(size));
+                file.ok = SDL_RWread(rw, file.data.data(), 1, file.data.size()) == file.data.size();
+            }
+            SDL_RWclose(rw);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            files[path] = std::move(file);
+        }
+        completed++;
+    });
+}
+
+int AssetLoader::uploadImages(TextureCache& cache) {
+    std::vector<DecodedImage> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(decoded);
+    }
+
+    int uploaded = 0;
+    for (auto& image : ready) {
+        if (cache.preload(image.path, image.surface)) uploaded++;
+        SDL_FreeSurface(image.surface);
+    }
+    return uploaded;
+}
+
+bool AssetLoader::takeFile(const std::string& path, std::vector<Uint8>& data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(path);
+    if (it == files.end()) return false;
+
+    if (!it->second.ok) {
+        std::cerr << "Erreur de lecture du fichier " << path << std::endl;
+        files.erase(it);
+        return false;
+    }
+
+    data.swap(it->second.data);
+    files.erase(it);
+    return true;
+}
+
+bool AssetLoader::isFileReady(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return files.find(path) != files.end();
+}
@@ -0,0 +1,199 @@
+#include "../headers/bikesynth.hpp"
+#include "../headers/GameConstants.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// La vitesse passe du jeu au thread audio sans verrou
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "std::atomic<int> must be lock-free");
+
+namespace {
+    // Temps de réponse du lissage de la vitesse (secondes)
+    const float SPEED_SMOOTHING_TIME = 0.08f;
+
+    // Bourdonnement des pneus : fréquence fondamentale selon la vitesse
+    const float HUM_BASE_HZ = 30.0f;
+    const float HUM_HZ_PER_SPEED = 9.0f;
+
+    // Cliquetis de la chaîne : cadence selon la vitesse et durée d'un clic
+    const float CLICKS_PER_SPEED = 3.0f;
+    const float CLICK_DURATION = 0.006f;
+
+    // Niveau de sortie à la vitesse maximale (part de la pleine échelle)
+    const float OUTPUT_LEVEL = 0.12f;
+    const float HUM_LEVEL = 0.7f;
+    const float CLICK_LEVEL = 0.5f;
+
+    // Vitesse lissée en dessous de laquelle le vélo est silencieux
+    const float SILENT_SPEED = 0.01f;
+
+    /* Partie fractionnaire d'une phase positive (troncature vectorisable) */
+    inline float wrap(float phase) {
+        return phase - static_cast<float>(static_cast<int>(phase));
+    }
+
+    /* Approximation parabolique d'une sinusoïde sur une phase dans [0, 1) */
+    inline float parabolicSine(float phase) {
+        const float x = 2.0f * phase - 1.0f;
+        return 4.0f * x * (1.0f - std::fabs(x));
+    }
+}
+
+BikeSynth::BikeSynth() :
+    running(false),
+    channels(2),
+    frequency(MIX_DEFAULT_FREQUENCY),
+    targetSpeed(0),
+    speed(0.0f),
+    humPhase(0.0f),
+    clickPhase(0.0f),
+    noisePos(0),
+    blockPos(BLOCK_FRAMES),
+    processCounter(0),
+    processedFrames(0)
+{
+    // Bruit reproductible (indépendant du générateur de la partie)
+    Uint32 state = 0x2545F491u;
+    for (int i = 0; i < NOISE_SIZE; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        noise[i] = static_cast<float>(state) / 2147483648.0f - 1.0f;
+    }
+    // Début de la table recopié à la fin : un bloc la lit toujours d'un seul tenant
+    std::copy(noise, noise + BLOCK_FRAMES, noise + NOISE_SIZE);
+}
+
+BikeSynth::~BikeSynth() {
+    stop();
+}
+
+bool BikeSynth::start() {
+    stop();
+
+    Uint16 format = 0;
+    if (!Mix_QuerySpec(&frequency, &format, &channels) || format != AUDIO_S16SYS) {
+        std::cerr << "Bike synth: unsupported audio format" << std::endl;
+        return false;
+    }
+
+    speed = 0.0f;
+    blockPos = BLOCK_FRAMES;
+    processCounter.store(0);
+    processedFrames.store(0);
+    if (!Mix_RegisterEffect(MIX_CHANNEL_POST, &BikeSynth::effect, nullptr, this)) {
+        std::cerr << "Bike synth: " << Mix_GetError() << std::endl;
+        return false;
+    }
+    running = true;
+    return true;
+}
+
+void BikeSynth::stop() {
+    if (!running) return;
+
+    // Mix_UnregisterEffect prend le verrou audio : au retour, l'effet ne s'exécute plus
+    Mix_UnregisterEffect(MIX_CHANNEL_POST, &BikeSynth::effect);
+    running = false;
+}
+
+double BikeSynth::getLoad() const {
+    const Uint64 frames = processedFrames.load(std::memory_order_relaxed);
+    if (frames == 0) return 0.0;
+    const double busy = static_cast<double>(processCounter.load(std::memory_order_relaxed)) / SDL_GetPerformanceFrequency();
+    return busy / (static_cast<double>(frames) / frequency);
+}
+
+void BikeSynth::renderBlock() {
+    const int frames = BLOCK_FRAMES;
+
+    // Vitesse lissée sur le bloc : les paramètres varient en rampe de début à fin
+    const float target = static_cast<float>(std::min(BIKE_MAX_SPEED, std::max(0, targetSpeed.load(std::memory_order_relaxed))));
+    const float smoothing = 1.0f - std::exp(-static_cast<float>(frames) / (SPEED_SMOOTHING_TIME * frequency));
+    const float startSpeed = speed;
+    const float endSpeed = speed + (target - speed) * smoothing;
+    const float step = 1.0f / frames;
+    const float rate = 1.0f / frequency;
+
+    const float humInc = (HUM_BASE_HZ + startSpeed * HUM_HZ_PER_SPEED) * rate;
+    const float humRamp = (endSpeed - startSpeed) * HUM_HZ_PER_SPEED * rate * step;
+    const float clickInc = startSpeed * CLICKS_PER_SPEED * rate;
+    const float clickRamp = (endSpeed - startSpeed) * CLICKS_PER_SPEED * rate * step;
+
+    // Clic de durée fixe : part de la période qu'il occupe au milieu du bloc
+    const float clickHz = std::max(1.0f, 0.5f * (startSpeed + endSpeed) * CLICKS_PER_SPEED);
+    const float clickDecay = 1.0f / std::min(1.0f, clickHz * CLICK_DURATION);
+
+    // Volumes proportionnels à la vitesse, en rampe eux aussi
+    const float gain = OUTPUT_LEVEL / BIKE_MAX_SPEED;
+    const float gainStart = startSpeed * gain;
+    const float gainRamp = (endSpeed - startSpeed) * gain * step;
+
+    // Copies locales : la boucle, de longueur fixe, ne relit aucun membre
+    const float humStart = humPhase;
+    const float clickStart = clickPhase;
+    const int noiseStart = noisePos;
+    for (int i = 0; i < frames; i++) {
+        const float t = static_cast<float>(i);
+
+        // Phase sous forme fermée : somme d'un incrément en rampe
+        const float hum = wrap(humStart + t * (humInc + 0.5f * humRamp * (t - 1.0f)));
+        const float click = wrap(clickStart + t * (clickInc + 0.5f * clickRamp * (t - 1.0f)));
+        const float grain = noise[noiseStart + i];
+
+        // Fondamentale et harmonique, modulées par le grain de la route
+        const float tone = 0.7f * parabolicSine(hum) + 0.3f * parabolicSine(wrap(2.0f * hum));
+        const float tyre = tone * (0.75f + 0.25f * grain);
+
+        // Clic : bruit sous une enveloppe quadratique au début de chaque période
+        const float fall = 1.0f - click * clickDecay;
+        const float envelope = 0.5f * (fall + std::fabs(fall));  // max(fall, 0) sans branchement
+        const float chain = envelope * envelope * grain;
+
+        block[i] = (gainStart + gainRamp * t) * (HUM_LEVEL * tyre + CLICK_LEVEL * chain);
+    }
+
+    const float n = static_cast<float>(frames);
+    humPhase = wrap(humPhase + n * (humInc + 0.5f * humRamp * (n - 1.0f)));
+    clickPhase = wrap(clickPhase + n * (clickInc + 0.5f * clickRamp * (n - 1.0f)));
+    noisePos = (noisePos + frames) & (NOISE_SIZE - 1);
+    speed = endSpeed;
+}
+
+void BikeSynth::effect(int channel, void* stream, int len, void* udata) {
+    (void)channel;
+    BikeSynth* synth = static_cast<BikeSynth*>(udata);
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const int channels = synth->channels;
+    const int frames = len / static_cast<int>(sizeof(Sint16) * channels);
+
+    // Vélo arrêté et silence atteint : rien à ajouter
+    if (synth->targetSpeed.load(std::memory_order_relaxed) <= 0 && synth->speed < SILENT_SPEED) {
+        synth->speed = 0.0f;
+    } else {
+        Sint16* out = static_cast<Sint16*>(stream);
+        for (int offset = 0; offset < frames;) {
+            if (synth->blockPos == BLOCK_FRAMES) {
+                synth->renderBlock();
+                synth->blockPos = 0;
+            }
+            const int count = std::min(BLOCK_FRAMES - synth->blockPos, frames - offset);
+            const float* block = synth->block + synth->blockPos;
+
+            // Ajout au mixage avec saturation (même signal sur chaque canal)
+            for (int i = 0; i < count; i++) {
+                const float value = block[i] * 32767.0f;
+                for (int c = 0; c < channels; c++) {
+                    const float mixed = out[i * channels + c] + value;
+                    out[i * channels + c] = static_cast<Sint16>(std::min(32767.0f, std::max(-32768.0f, mixed)));
+                }
+            }
+            out += count * channels;
+            offset += count;
+            synth->blockPos += count;
+        }
+    }
+
+    synth->processCounter.fetch_add(SDL_GetPerformanceCounter() - start, std::memory_order_relaxed);
+    synth->processedFrames.fetch_add(frames, std::memory_order_relaxed);
+}
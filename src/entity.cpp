@@ -1,5 +1,6 @@
 #include "../headers/entity.hpp"
 #include "../headers/game.hpp"
+#include "../headers/profiler.hpp"
 #include <iostream>
 #include <string>
 
@@ -11,21 +12,11 @@ Utilise une liste d'initialisation pour optimiser la création des attributs
 Entity::Entity(Game* game) : 
     game(game), 
     texture(nullptr),
-    lane(LANES / 2),  // Position de départ au milieu
-    width(70),
-    height(80),
-    moveSpeed(10),
-    verticalSpeed(0),  // Vélo fixe verticalement
-    speed(3),         // Vitesse initiale
-    minSpeed(1),      // Vitesse minimale
-    maxSpeed(10)      // Vitesse maximale
+    width(BIKE_WIDTH),
+    height(BIKE_HEIGHT)
 {
-    // Calcul de la position X centrée dans la voie
-    x = lane * LANE_WIDTH + (LANE_WIDTH - width) / 2;
-    targetX = x;
-    
     // Position Y fixe en bas de l'écran
-    y = WINDOW_HEIGHT - height - 50;
+    y = BIKE_Y;
     
     // Chargement de la texture
     loadTexture();
@@ -33,91 +24,102 @@ Entity::Entity(Game* game) :
 
 /* 
 Destructeur de la classe Entity
-Libère la mémoire allouée pour la texture SDL
+Rend la texture empruntée au cache du jeu
 Évite les fuites de mémoire 
 */
 Entity::~Entity() {
     if (texture) {
-        SDL_DestroyTexture(texture);
+        game->getTextureCache().release(BIKE_TEXTURE_PATH);
         texture = nullptr;  // Bonne pratique pour éviter les double-free
     }
 }
 
 /* 
-Gère les événements SDL pour l'entité
-Traite les entrées clavier pour contrôler le vélo 
+Traduit les entrées clavier en actions du vélo
+Support des contrôles WASD et flèches
 */
-void Entity::handleEvents(SDL_Event& event) {
-    if (event.type == SDL_KEYDOWN) {
-        switch (event.key.keysym.sym) {
-            case SDLK_LEFT:
-            case SDLK_a:  // Support des contrôles WASD et flèches
-                moveLeft();
-                break;
-            case SDLK_RIGHT:
-            case SDLK_d:
-                moveRight();
-                break;
-            case SDLK_UP:
-            case SDLK_w:
-                increaseSpeed();
-                break;
-            case SDLK_DOWN:
-            case SDLK_s:
-                decreaseSpeed();
-                break;
-        }
+bool Entity::actionForEvent(const SDL_Event& event, InputAction& action) {
+    if (event.type != SDL_KEYDOWN) return false;
+
+    switch (event.key.keysym.sym) {
+        case SDLK_LEFT:
+        case SDLK_a:
+            action = ACTION_MOVE_LEFT;
+            return true;
+        case SDLK_RIGHT:
+        case SDLK_d:
+            action = ACTION_MOVE_RIGHT;
+            return true;
+        case SDLK_UP:
+        case SDLK_w:
+            action = ACTION_SPEED_UP;
+            return true;
+        case SDLK_DOWN:
+        case SDLK_s:
+            action = ACTION_SPEED_DOWN;
+            return true;
+        default:
+            return false;
     }
 }
 
 /* 
-Met à jour l'état de l'entité
-Gère le mouvement fluide entre la position actuelle et la position cible 
+Applique une action au vélo
 */
-void Entity::update() {
-    // Animation fluide du mouvement horizontal
-    if (x < targetX) {
-        x += moveSpeed;
-        if (x > targetX) x = targetX;  // Évite le dépassement
-    } else if (x > targetX) {
-        x -= moveSpeed;
-        if (x < targetX) x = targetX;  // Évite le dépassement
+void Entity::applyAction(InputAction action) {
+    switch (action) {
+        case ACTION_MOVE_LEFT:
+            moveLeft();
+            break;
+        case ACTION_MOVE_RIGHT:
+            moveRight();
+            break;
+        case ACTION_SPEED_UP:
+            increaseSpeed();
+            break;
+        case ACTION_SPEED_DOWN:
+            decreaseSpeed();
+            break;
+        default:
+            break;
     }
-    
-    // Position Y fixe (le vélo ne se déplace pas verticalement)
 }
 
 /* 
 Affiche l'entité à l'écran
 Gère le rendu de la texture et des indicateurs visuels 
+La position est interpolée entre les deux derniers pas de simulation
 */
-void Entity::render() {
+void Entity::render(float alpha) {
     if (!texture || !game) return;  // Protection contre les pointeurs nuls
     
     // Rendu de la texture principale
-    SDL_Rect destRect = {x, y, width, height};
-    SDL_RenderCopy(game->getRenderer(), texture, nullptr, &destRect);
+    const Race& race = game->getRace();
+    const float prevX = race.getPrevX();
+    int drawX = static_cast<int>(prevX + (race.getX() - prevX) * alpha + 0.5f);
+    SDL_Rect destRect = {drawX, y, width, height};
+    game->getSpriteBatch().draw(texture, nullptr, destRect, LAYER_PLAYER);
     
     // Affichage de la boîte de collision en mode debug
     #ifdef DEBUG_COLLISION
-    SDL_SetRenderDrawColor(game->getRenderer(), 0, 255, 0, 128);
-    SDL_Rect collisionBox = getCollisionBox();
-    SDL_RenderDrawRect(game->getRenderer(), &collisionBox);
+    game->getSpriteBatch().drawRect(getCollisionBox(), SDL_Color{0, 255, 0, 128}, LAYER_PLAYER);
     #endif
     
     // Affichage de l'indicateur de vitesse
-    renderSpeedIndicator();
+    renderSpeedIndicator(drawX);
 }
 
 /* 
 Affiche l'indicateur de vitesse du vélo
 Nouvelle méthode pour respecter le principe de responsabilité unique 
 */
-void Entity::renderSpeedIndicator() {
-    SDL_SetRenderDrawColor(game->getRenderer(), 255, 0, 0, 255);
+void Entity::renderSpeedIndicator(int drawX) {
+    // Les barres sont regroupées avec les autres rectangles de la couche
+    SDL_Color barColor = {255, 0, 0, 255};
+    const int speed = game->getRace().getSpeed();
     for (int i = 0; i < speed; i++) {
-        SDL_Rect speedBar = {x + i * 5, y - 10, 4, 8};
-        SDL_RenderFillRect(game->getRenderer(), &speedBar);
+        SDL_Rect speedBar = {drawX + i * 5, y - 10, 4, 8};
+        game->getSpriteBatch().fillRect(speedBar, barColor, LAYER_PLAYER);
     }
 }
 
@@ -126,70 +128,47 @@ Retourne la boîte de collision de l'entité
 Utilisée pour la détection de collision 
 */
 SDL_Rect Entity::getCollisionBox() const {
-    // Boîte légèrement plus petite que l'entité pour collision plus précise
-    const int padding = 5;
-    SDL_Rect collisionBox = {
-        x + padding,
-        y + padding,
-        width - 2 * padding,
-        height - 2 * padding
-    };
-    return collisionBox;
-}
-
-/* 
-Réinitialise l'entité à son état initial
-Appelée après une collision ou au début d'une nouvelle partie 
-*/
-void Entity::reset() {
-    lane = LANES / 2;  // Retour à la voie du milieu
-    speed = 3;         // Réinitialisation de la vitesse
-    
-    // Recalcul des positions
-    x = lane * LANE_WIDTH + (LANE_WIDTH - width) / 2;
-    targetX = x;
-    y = WINDOW_HEIGHT - height - 50;
+    // Boîte légèrement plus petite que l'entité, calculée par les règles
+    return game->getRace().getBikeCollisionBox();
 }
 
 /* 
 Déplace l'entité vers la voie de gauche
-Vérifie les limites pour éviter de sortir de l'écran 
+Les limites sont vérifiées par les règles de la partie (Race) 
 */
 void Entity::moveLeft() {
-    if (lane > 0) {
-        lane--;
-        targetX = lane * LANE_WIDTH + (LANE_WIDTH - width) / 2;
+    if (game->getRace().applyAction(ACTION_MOVE_LEFT)) {
+        game->playSound(SoundBank::SOUND_LANE_CHANGE);
     }
 }
 
 /* 
 Déplace l'entité vers la voie de droite
-Vérifie les limites pour éviter de sortir de l'écran 
+Les limites sont vérifiées par les règles de la partie (Race) 
 */
 void Entity::moveRight() {
-    if (lane < LANES - 1) {
-        lane++;
-        targetX = lane * LANE_WIDTH + (LANE_WIDTH - width) / 2;
+    if (game->getRace().applyAction(ACTION_MOVE_RIGHT)) {
+        game->playSound(SoundBank::SOUND_LANE_CHANGE);
     }
 }
 
 /* 
 Augmente la vitesse de l'entité
-Respecte la vitesse maximale définie 
+La vitesse maximale est vérifiée par les règles de la partie (Race) 
 */
 void Entity::increaseSpeed() {
-    if (speed < maxSpeed) {
-        speed++;
+    if (game->getRace().applyAction(ACTION_SPEED_UP)) {
+        game->playSound(SoundBank::SOUND_SPEED_UP);
     }
 }
 
 /* 
 Diminue la vitesse de l'entité
-Respecte la vitesse minimale définie 
+La vitesse minimale est vérifiée par les règles de la partie (Race) 
 */
 void Entity::decreaseSpeed() {
-    if (speed > minSpeed) {
-        speed--;
+    if (game->getRace().applyAction(ACTION_SPEED_DOWN)) {
+        game->playSound(SoundBank::SOUND_SPEED_DOWN);
     }
 }
 
@@ -197,36 +176,23 @@ void Entity::decreaseSpeed() {
 Retourne la vitesse actuelle de l'entité 
 */
 int Entity::getSpeed() const {
-    return speed;
+    return game->getRace().getSpeed();
 }
 
 /* 
-Charge la texture de l'entité depuis un fichier
+Emprunte la texture du vélo au cache du jeu
 Gère les erreurs de chargement avec une texture de secours 
 */
 void Entity::loadTexture() {
-    SDL_Surface* surface = IMG_Load("assets/bike.png");
-    
-    if (!surface) {
-        std::cerr << "Erreur de chargement de l'image du vélo: " << IMG_GetError() << std::endl;
-        
+    PROFILE_SCOPE("Entity::loadTexture");
+    const int w = width;
+    const int h = height;
+    texture = game->getTextureCache().acquire(BIKE_TEXTURE_PATH, [w, h]() {
         // Création d'une texture de secours (rectangle vert)
-        surface = SDL_CreateRGBSurface(0, width, height, 32, 0, 0, 0, 0);
+        SDL_Surface* surface = SDL_CreateRGBSurface(0, w, h, 32, 0, 0, 0, 0);
         if (surface) {
             SDL_FillRect(surface, nullptr, SDL_MapRGB(surface->format, 0, 255, 0));
-        } else {
-            std::cerr << "Échec de création de la surface de secours!" << std::endl;
-            return;
         }
-    }
-    
-    // Création de la texture à partir de la surface
-    if (surface) {
-        texture = SDL_CreateTextureFromSurface(game->getRenderer(), surface);
-        SDL_FreeSurface(surface);  // Libération de la surface qui n'est plus nécessaire
-        
-        if (!texture) {
-            std::cerr << "Échec de création de la texture: " << SDL_GetError() << std::endl;
-        }
-    }
+        return surface;
+    });
 }
\ No newline at end of file
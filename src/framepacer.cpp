@@ -0,0 +1,85 @@
+#include "../headers/framepacer.hpp"
+#include <iostream>
+#include <thread>
+
+/*
+Limiteur de framerate
+L'attente se fait en deux temps : un SDL_Delay qui s'arrête avant l'échéance
+(la marge absorbe l'imprécision de l'ordonnanceur), puis une attente active
+qui cède le processeur jusqu'à l'échéance exacte.
+*/
+
+FramePacer::FramePacer(int fps) :
+    targetRate(0),
+    frequency(SDL_GetPerformanceFrequency()),
+    period(0),
+    spinMargin(0),
+    deadline(0),
+    frames(0),
+    lateFrames(0),
+    totalOvershoot(0),
+    maxOvershoot(0) {
+    setSpinMargin(2.0);
+    setTargetRate(fps);
+}
+
+void FramePacer::setTargetRate(int fps) {
+    targetRate = fps > 0 ? fps : 0;
+    period = targetRate > 0 ? frequency / targetRate : 0;
+    reset();
+}
+
+void FramePacer::setSpinMargin(double ms) {
+    spinMargin = static_cast<Uint64>(ms * frequency / 1000.0);
+}
+
+void FramePacer::reset() {
+    deadline = SDL_GetPerformanceCounter() + period;
+}
+
+void FramePacer::waitForNextFrame() {
+    if (period == 0) return;
+
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (now < deadline) {
+        // Sommeil grossier jusqu'à la marge d'attente active
+        Uint64 remaining = deadline - now;
+        if (remaining > spinMargin) {
+            Uint32 sleepMs = static_cast<Uint32>((remaining - spinMargin) * 1000 / frequency);
+            if (sleepMs > 0) SDL_Delay(sleepMs);
+        }
+
+        // Attente active pour le reste de l'intervalle
+        while ((now = SDL_GetPerformanceCounter()) < deadline) {
+            std::this_thread::yield();
+        }
+    } else {
+        lateFrames++;
+    }
+
+    Uint64 overshoot = now - deadline;
+    frames++;
+    totalOvershoot += overshoot;
+    if (overshoot > maxOvershoot) maxOvershoot = overshoot;
+
+    // Échéance suivante : on garde la cadence, sauf si on a pris plus d'une image de retard
+    deadline += period;
+    if (now > deadline) deadline = now + period;
+}
+
+double FramePacer::getMeanOvershootMs() const {
+    if (frames == 0) return 0.0;
+    return totalOvershoot * 1000.0 / frequency / frames;
+}
+
+double FramePacer::getMaxOvershootMs() const {
+    return maxOvershoot * 1000.0 / frequency;
+}
+
+void FramePacer::printStats() const {
+    if (frames == 0) return;
+    std::cout << "Frame pacer: " << frames << " frames at " << targetRate << " FPS, "
+              << "overshoot mean " << getMeanOvershootMs() << " ms, max " << getMaxOvershootMs() << " ms, "
+              << lateFrames << " late frames" << std::endl;
+}
@@ -8,10 +8,12 @@ gestion des entités, rendu graphique et logique de jeu. */
 #include "../headers/menu.hpp"
 #include "../headers/entity.hpp"
 #include "../headers/object.hpp"
+#include "../headers/profiler.hpp"
+#include "../headers/resampler.hpp"
+#include "../headers/alloccounter.hpp"
 #include <iostream>
 #include <algorithm>
-#include <ctime>
-#include <random>
+#include <cstring>
    
    /* Constructeur de la classe Game
       Initialise tous les membres à leurs valeurs par défaut */
@@ -21,17 +23,34 @@ gestion des entités, rendu graphique et logique de jeu. */
        font(nullptr),
        smallFont(nullptr),
        roadTexture(nullptr),
-       menuMusic(nullptr),
-       gameMusic(nullptr),
+       roadLayer(nullptr),
+       roadScroll(0.0f),
+       prevRoadScroll(0.0f),
+       audioBufferSize(AUDIO_BUFFER_SAMPLES),
+       startupCounter(0),
        isRunning(false),
        currentState(GameState::MENU),
        gameWon(false),
        tutorialState(TUTORIAL_NONE),
        tutorialStartTime(0),
        tutorialsCompleted(false),
-       lastObstacleTime(0) 
+       headless(false),
+       simulationTime(0.0),
+       simulationTick(0),
+       replayAutoRounds(false),
+       uncappedRender(false),
+       allocationTracking(false),
+       allocationTest(false),
+       allocationFrameState(GameState::MENU),
+       playingFrames(0),
+       budgetViolations(0),
+       track(&DefaultTrack::CONFIG),
+       seed(1),
+       framePacer(FPS),
+       vsync(false)
    {
        // Utilisation de listes d'initialisation pour optimiser la création d'objets
+       race.setClock(&Game::gameClock, this);
    }
    
    /* Destructeur de la classe Game
@@ -42,6 +61,9 @@ gestion des entités, rendu graphique et logique de jeu. */
    
    /* Initialise les ressources SDL et du jeu */
    bool Game::initialize() {
+       PROFILE_SCOPE("Game::initialize");
+       startupCounter = SDL_GetPerformanceCounter();
+   
        // Initialisation de SDL et ses extensions
        if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
            std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
@@ -58,7 +80,8 @@ gestion des entités, rendu graphique et logique de jeu. */
            return false;
        }
    
-       if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
+       // Petit tampon : un effet déclenché sort au plus tard deux blocs après
+       if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, audioBufferSize) < 0) {
            std::cerr << "SDL_mixer initialization failed: " << Mix_GetError() << std::endl;
            return false;
        }
@@ -72,7 +95,9 @@ gestion des entités, rendu graphique et logique de jeu. */
        }
    
        // Création du renderer
-       renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+       Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+       if (vsync) rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+       renderer = SDL_CreateRenderer(window, -1, rendererFlags);
        if (!renderer) {
            std::cerr << "Renderer creation failed: " << SDL_GetError() << std::endl;
            return false;
@@ -80,32 +105,33 @@ gestion des entités, rendu graphique et logique de jeu. */
    
        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
    
-       // Chargement des polices
-       font = TTF_OpenFont("assets/OpenSans-Regular.ttf", 28);
-       smallFont = TTF_OpenFont("assets/OpenSans-Regular.ttf", 18);
-       if (!font || !smallFont) {
-           std::cerr << "Failed to load font: " << TTF_GetError() << std::endl;
+       // Polices, images et musiques chargées en parallèle,
+       // les images étant ramenées à leur taille d'affichage
+       textureCache.setRenderer(renderer);
+       for (const ImageDrawSize& image : IMAGE_DRAW_SIZES) {
+           textureCache.setTargetSize(image.path, image.width, image.height);
+       }
+       if (!loadAssets()) {
            return false;
        }
    
-       // Chargement de la texture de route avec gestion d'erreur
-       SDL_Surface* loadedSurface = IMG_Load("assets/road.png");
-       if (!loadedSurface) {
+       // Texture de route (déjà dans le cache, sauf si le fichier est illisible) ;
+       // la route unie d'une piste à plus ou moins de voies y est ajoutée ici
+       const char* roadPath = getRoadTexturePath();
+       if (track->lanes != LANES) {
+           SDL_Surface* plainSurface = createPlainRoadSurface();
+           textureCache.preload(roadPath, plainSurface);
+           SDL_FreeSurface(plainSurface);
+       }
+       roadTexture = textureCache.acquire(roadPath, [this]() {
            // Création d'une texture de secours
-           SDL_Surface* fallbackSurface = SDL_CreateRGBSurface(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, 0, 0, 0, 0);
-           SDL_FillRect(fallbackSurface, NULL, SDL_MapRGB(fallbackSurface->format, 80, 80, 80));
-           
-           // Ajout des lignes de voie
-           for (int i = 1; i < LANES; i++) {
-               SDL_Rect lineRect = {i * LANE_WIDTH - 2, 0, 4, WINDOW_HEIGHT};
-               SDL_FillRect(fallbackSurface, &lineRect, SDL_MapRGB(fallbackSurface->format, 255, 255, 0));
-           }
-           
-           roadTexture = SDL_CreateTextureFromSurface(renderer, fallbackSurface);
-           SDL_FreeSurface(fallbackSurface);
-       } else {
-           roadTexture = SDL_CreateTextureFromSurface(renderer, loadedSurface);
-           SDL_FreeSurface(loadedSurface);
+           return createPlainRoadSurface();
+       });
+   
+       // Route et lignes de voie composées une fois pour toutes
+       {
+           PROFILE_SCOPE("buildRoadLayer");
+           buildRoadLayer();
        }
    
        // Chargement des fichiers audio
@@ -117,60 +143,538 @@ gestion des entités, rendu graphique et logique de jeu. */
        // Création des objets du jeu
        menu = std::make_unique<Menu>(this);
        velo = std::make_unique<Entity>(this); // Plus besoin de spécifier EntityType
+       wall = std::make_unique<Object>(this); // Texture des murs chargée une seule fois
        
-       // Initialisation du générateur de nombres aléatoires
-       std::srand(static_cast<unsigned int>(std::time(nullptr)));
+       // Graine affichée : une partie signalée peut être rejouée avec --seed
+       setSeed(seed);
+       std::cout << "Seed: " << seed << std::endl;
    
        // Démarrage de la musique du menu
-       playMusic(menuMusic);
+       playMusic(MusicEngine::TRACK_MENU);
+       beginRecording(0);
        isRunning = true;
        return true;
    }
    
-   /* Charge les fichiers audio du jeu */
-   bool Game::loadAudio() {
-       menuMusic = Mix_LoadMUS("assets/menu_music.wav");
-       if (!menuMusic) {
-           std::cerr << "Failed to load menu music: " << Mix_GetError() << std::endl;
+   /* Initialise uniquement la logique du jeu, sans aucune ressource graphique ni audio */
+   bool Game::initializeHeadless(Uint64 seed) {
+       if (SDL_Init(0) < 0) {
+           std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
            return false;
        }
    
-       gameMusic = Mix_LoadMUS("assets/game1_music.mp3");
-       if (!gameMusic) {
-           std::cerr << "Failed to load game music: " << Mix_GetError() << std::endl;
-           Mix_FreeMusic(menuMusic);
+       headless = true;
+       simulationTime = 0;
+       simulationTick = 0;
+   
+       // Sans renderer, le cache ne crée aucune texture : le vélo et les obstacles
+       // ne gardent que leur logique de déplacement et de collision
+       velo = std::make_unique<Entity>(this);
+       wall = std::make_unique<Object>(this);
+   
+       setSeed(seed);
+       startHeadlessRound();
+       beginRecording(REPLAY_AUTO_ROUNDS);
+       isRunning = true;
+       return true;
+   }
+   
+   /* Chargement parallèle des ressources
+      Les threads de travail décodent les images et lisent les fichiers pendant
+      que le thread principal envoie les textures prêtes au GPU et anime la barre
+      de progression. Les polices sont ouvertes dès que leur fichier est lu. */
+   bool Game::loadAssets() {
+       PROFILE_SCOPE("Game::loadAssets");
+       ThreadPool pool(0, "asset loader");
+       AssetLoader loader(pool);
+   
+       // Conversion des images au format préféré du renderer sur les threads de travail
+       SDL_RendererInfo info;
+       if (SDL_GetRendererInfo(renderer, &info) == 0 && info.num_texture_formats > 0) {
+           loader.setSurfaceFormat(info.texture_formats[0]);
+       }
+   
+       // Ressources pré-décodées : envoyées au GPU directement depuis la projection,
+       // seules celles absentes de l'archive sont chargées depuis assets/
+       if (assetArchive.open(ASSET_ARCHIVE_PATH)) {
+           std::cout << "Using asset archive " << ASSET_ARCHIVE_PATH << std::endl;
+       }
+   
+       // La police en premier : l'écran de chargement l'utilise
+       const char* const files[] = {FONT_PATH, MENU_MUSIC_PATH, GAME_MUSIC_PATH, GAME_OVER_SOUND_PATH};
+       for (const char* path : files) {
+           if (!assetArchive.find(path)) loader.loadFile(path);
+       }
+   
+       const char* const images[] = {MENU_BACKGROUND_PATH, ROAD_TEXTURE_PATH, BIKE_TEXTURE_PATH, WALL_TEXTURE_PATH};
+       for (const char* path : images) {
+           if (std::strcmp(path, ROAD_TEXTURE_PATH) == 0 && track->lanes != LANES) continue;
+           const PakEntry* entry = assetArchive.find(path);
+           SDL_Surface* surface = entry ? assetArchive.createSurface(*entry) : nullptr;
+           bool uploaded = surface && textureCache.preload(path, surface);
+           SDL_FreeSurface(surface);
+           if (!uploaded) {
+               int width = 0, height = 0;
+               textureCache.getTargetSize(path, width, height);
+               loader.loadImage(path, width, height);
+           }
+       }
+   
+       bool fontRead = assetArchive.find(FONT_PATH) != nullptr;
+       if (fontRead && !openFonts()) return false;
+   
+       while (!loader.isDone()) {
+           SDL_Event event;
+           while (SDL_PollEvent(&event)) {
+               if (event.type == SDL_QUIT) return false;
+           }
+   
+           loader.uploadImages(textureCache);
+           if (!fontRead && loader.isFileReady(FONT_PATH)) {
+               fontRead = true;
+               if (!loader.takeFile(FONT_PATH, fontData) || !openFonts()) return false;
+           }
+   
+           renderLoadingScreen(loader.getProgress());
+           if (!vsync) framePacer.waitForNextFrame();
+       }
+   
+       loader.uploadImages(textureCache);
+       if (!fontRead && (!loader.takeFile(FONT_PATH, fontData) || !openFonts())) return false;
+   
+       // Un fichier illisible laisse le tampon vide : l'ouverture échoue avec un message d'erreur
+       loader.takeFile(MENU_MUSIC_PATH, menuMusicData);
+       loader.takeFile(GAME_MUSIC_PATH, gameMusicData);
+       loader.takeFile(GAME_OVER_SOUND_PATH, gameOverSoundData);
+   
+       std::cout << "Assets loaded in "
+                 << (SDL_GetPerformanceCounter() - startupCounter) * 1000.0 / SDL_GetPerformanceFrequency()
+                 << " ms (" << pool.size() << " loader threads)" << std::endl;
+   
+       // Mémoire économisée par la réduction des images à leur taille d'affichage
+       Uint64 resampled = 0, bytesBefore = 0, bytesAfter = 0;
+       getResampleStats(&resampled, &bytesBefore, &bytesAfter);
+       if (resampled > 0) {
+           std::cout << "Resampled " << resampled << " images: " << bytesBefore / 1024 << " KiB -> "
+                     << bytesAfter / 1024 << " KiB (" << (static_cast<Sint64>(bytesBefore) - static_cast<Sint64>(bytesAfter)) / 1024
+                     << " KiB saved)" << std::endl;
+       }
+       return true;
+   }
+   
+   /* Flux de lecture d'une ressource : archive projetée si elle la contient,
+      sinon le tampon lu par le chargeur */
+   SDL_RWops* Game::openAssetRW(const char* path, const std::vector<Uint8>& data) const {
+       const PakEntry* entry = assetArchive.find(path);
+       if (entry && entry->type == PAK_BLOB) return assetArchive.openRW(*entry);
+       return SDL_RWFromConstMem(data.data(), static_cast<int>(data.size()));
+   }
+   
+   /* Ouvre les polices depuis la mémoire et rastérise leurs glyphes
+      Les deux tailles partagent le même fichier, lu une seule fois */
+   bool Game::openFonts() {
+       PROFILE_SCOPE("load fonts");
+       font = TTF_OpenFontRW(openAssetRW(FONT_PATH, fontData), 1, 28);
+       smallFont = TTF_OpenFontRW(openAssetRW(FONT_PATH, fontData), 1, 18);
+       if (!font || !smallFont) {
+           std::cerr << "Failed to load font: " << TTF_GetError() << std::endl;
            return false;
        }
    
+       // Rastérisation unique des glyphes pour le texte du HUD
+       if (!fontAtlas.build(renderer, font) || !smallFontAtlas.build(renderer, smallFont)) {
+           std::cerr << "Failed to build glyph atlas" << std::endl;
+           return false;
+       }
        return true;
    }
    
-   /* Joue une musique en boucle */
-   void Game::playMusic(Mix_Music* music) {
-       if (music) {
-           Mix_HaltMusic();
-           if (Mix_PlayingMusic() == 0) {
-               Mix_PlayMusic(music, -1);
-           }
+   /* Affiche l'écran de chargement : barre de progression et pourcentage */
+   void Game::renderLoadingScreen(float progress) {
+       SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+       SDL_RenderClear(renderer);
+       spriteBatch.beginFrame();
+   
+       const int barWidth = WINDOW_WIDTH - 200;
+       SDL_Rect frame = {100, WINDOW_HEIGHT / 2 - 15, barWidth, 30};
+       SDL_Rect fill = {frame.x + 4, frame.y + 4, static_cast<int>((barWidth - 8) * progress), frame.h - 8};
+       spriteBatch.drawRect(frame, SDL_Color{255, 255, 255, 255}, LAYER_HUD);
+       spriteBatch.fillRect(fill, SDL_Color{0, 200, 0, 255}, LAYER_HUD);
+   
+       // Le texte n'apparaît qu'une fois la police chargée
+       if (fontAtlas.isReady()) {
+           char text[32];
+           SDL_snprintf(text, sizeof(text), "Chargement... %d%%", static_cast<int>(progress * 100.0f));
+           fontAtlas.drawText(spriteBatch, text, frame.x, frame.y - 45, SDL_Color{255, 255, 255, 255}, LAYER_HUD_TEXT);
+       }
+   
+       spriteBatch.flush(renderer);
+       spriteBatch.endFrame();
+       SDL_RenderPresent(renderer);
+   }
+   
+   /* Confie les musiques, ouvertes depuis la mémoire (archive ou fichiers lus
+      au chargement), au moteur de musique qui les décode sur son thread,
+      puis décode les effets sonores et branche le bruit du vélo
+      Un morceau illisible est signalé par le moteur et remplacé par du silence */
+   bool Game::loadAudio() {
+       PROFILE_SCOPE("Game::loadAudio");
+       SDL_RWops* sources[MusicEngine::TRACK_COUNT];
+       sources[MusicEngine::TRACK_MENU] = openAssetRW(MENU_MUSIC_PATH, menuMusicData);
+       sources[MusicEngine::TRACK_GAME] = openAssetRW(GAME_MUSIC_PATH, gameMusicData);
+       if (!music.start(sources, audioBufferSize)) return false;
+       if (!sounds.load(openAssetRW(GAME_OVER_SOUND_PATH, gameOverSoundData))) return false;
+   
+       // Le bruit du vélo est facultatif : le jeu continue sans lui
+       if (!bikeSound.start()) {
+           std::cerr << "Bike sound disabled" << std::endl;
        }
+       return true;
+   }
+   
+   /* Joue une musique en boucle : sans effet si elle est déjà demandée */
+   void Game::playMusic(MusicEngine::Track track) {
+       music.play(track);
    }
    
    /* Boucle principale du jeu
-      Gère le timing, les événements, les mises à jour et le rendu */
+      La simulation avance par pas fixes de SIM_DT grâce à un accumulateur,
+      le rendu interpole les positions entre les deux derniers pas */
    void Game::run() {
+       const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+       Uint64 previousCounter = SDL_GetPerformanceCounter();
+       double accumulator = 0.0;
+       framePacer.reset();
+   
        while (isRunning) {
-           frameStart = SDL_GetTicks();
+           // Temps réel écoulé depuis l'image précédente, borné après un gel
+           Uint64 currentCounter = SDL_GetPerformanceCounter();
+           double elapsed = (currentCounter - previousCounter) / frequency;
+           previousCounter = currentCounter;
+           perfOverlay.addFrame(elapsed * 1000.0);
+           if (elapsed > MAX_FRAME_TIME) elapsed = MAX_FRAME_TIME;
+           accumulator += elapsed;
    
-           handleEvents();
-           update();
-           render();
+           PROFILE_SCOPE("frame");
+           beginAllocationFrame();
+   
+           {
+               PROFILE_SCOPE("handleEvents");
+               handleEvents();
+           }
+   
+           // Rattrapage de la simulation par pas fixes
+           while (accumulator >= SIM_DT) {
+               PROFILE_SCOPE("update");
+               simulationTime += SIM_STEP_MS;
+               update();
+               simulationTick++;
+               accumulator -= SIM_DT;
+           }
+   
+           render(static_cast<float>(accumulator / SIM_DT));
+   
+           // Délai entre le lancement et la première image où le joueur peut agir
+           if (startupCounter != 0) {
+               std::cout << "Time to first interactive frame: "
+                         << (SDL_GetPerformanceCounter() - startupCounter) * 1000.0 / frequency << " ms" << std::endl;
+               startupCounter = 0;
+           }
            
-           // Gestion du framerate constant
-           frameTime = SDL_GetTicks() - frameStart;
-           if (FRAME_DELAY > frameTime) {
-               SDL_Delay(FRAME_DELAY - frameTime);
+           endAllocationFrame(ALLOC_WARMUP_FRAMES);
+           
+           // Gestion du framerate constant (SDL_RenderPresent attend déjà en VSync)
+           if (!uncappedRender && !vsync) {
+               PROFILE_SCOPE("frame wait");
+               framePacer.waitForNextFrame();
+           }
+       }
+   
+       finishRecording();
+       framePacer.printStats();
+       reportAllocations();
+       if (Profiler::isEnabled()) Profiler::dumpChromeTrace(PROFILE_TRACE_PATH);
+   }
+   
+   /* Boucle de simulation sans affichage
+      Enchaîne les manches jusqu'à atteindre le nombre de ticks demandé */
+   void Game::runHeadless(int ticks) {
+       int rounds = 0;
+       int collisions = 0;
+       Uint64 start = SDL_GetPerformanceCounter();
+   
+       // Allocations relevées après une seconde de simulation (montée en charge terminée)
+       const int warmupTicks = SIM_HZ;
+       Uint64 warmupAllocations = 0;
+   
+       for (int tick = 0; tick < ticks && isRunning; tick++) {
+           if (tick == warmupTicks) warmupAllocations = AllocCounter::getCount();
+           beginAllocationFrame();
+           headlessInput();
+           simulationTime += SIM_STEP_MS;
+           {
+               PROFILE_SCOPE("update");
+               update();
+           }
+           simulationTick++;
+   
+           if (currentState == GameState::GAME_OVER) {
+               if (!gameWon) collisions++;
+               rounds++;
+               startHeadlessRound();
+           }
+           endAllocationFrame(warmupTicks);
+       }
+   
+       double seconds = static_cast<double>(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+       std::cout << "Headless: " << ticks << " ticks in " << seconds << " s ("
+                 << (seconds > 0.0 ? ticks / seconds : 0.0) << " ticks/s), "
+                 << rounds << " rounds, " << collisions << " collisions" << std::endl;
+       finishRecording();
+       if (AllocCounter::isEnabled() && ticks > warmupTicks) {
+           std::cout << "Heap allocations after warm-up: " << AllocCounter::getCount() - warmupAllocations << std::endl;
+       }
+       reportAllocations();
+       if (Profiler::isEnabled()) Profiler::dumpChromeTrace(PROFILE_TRACE_PATH);
+   }
+   
+   /* Charge le rejeu et reproduit les conditions de son enregistrement :
+      même graine, même état de départ, aucun rendu ni audio */
+   bool Game::initializeReplay(const std::string& path) {
+       if (!replay.load(path)) return false;
+       if (SDL_Init(0) < 0) {
+           std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
+           return false;
+       }
+   
+       // Même piste que l'enregistrement
+       const int lanes = (replay.getFlags() >> REPLAY_LANES_SHIFT) & 0xFF;
+       if (lanes != 0) {
+           const TrackConfig* config = findTrackConfig(lanes);
+           if (!config || config->width > WINDOW_WIDTH) {
+               std::cerr << "Replay uses an unsupported track (" << lanes << " lanes)" << std::endl;
+               return false;
+           }
+           setTrack(*config);
+       }
+   
+       headless = true;
+       simulationTime = 0;
+       simulationTick = 0;
+       velo = std::make_unique<Entity>(this);
+       wall = std::make_unique<Object>(this);
+   
+       setSeed(replay.getSeed());
+       replayAutoRounds = (replay.getFlags() & REPLAY_AUTO_ROUNDS) != 0;
+       if (replayAutoRounds) {
+           startHeadlessRound();
+       }
+       isRunning = true;
+       return true;
+   }
+   
+   /* Boucle de rejeu
+      Les actions sont appliquées avant le pas où elles ont été enregistrées,
+      dans le même ordre que la boucle d'origine (événements puis simulation) */
+   bool Game::runReplay() {
+       Uint64 start = SDL_GetPerformanceCounter();
+       const Uint32 finalTick = replay.getFinalTick();
+   
+       while (isRunning) {
+           InputAction action;
+           while (replay.nextAction(simulationTick, action)) {
+               applyAction(action);
+           }
+           if (simulationTick >= finalTick) break;
+   
+           simulationTime += SIM_STEP_MS;
+           update();
+           simulationTick++;
+   
+           if (replayAutoRounds && currentState == GameState::GAME_OVER) {
+               startHeadlessRound();
            }
        }
+   
+       double seconds = static_cast<double>(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+       Uint64 hash = computeStateHash();
+       bool match = simulationTick == finalTick && hash == replay.getExpectedHash();
+       std::cout << "Replay: " << replay.getActionCount() << " actions, " << simulationTick << " ticks in "
+                 << seconds << " s, state hash " << std::hex << hash << " (expected "
+                 << replay.getExpectedHash() << ")" << std::dec << std::endl;
+       std::cout << (match ? "Replay OK" : "Replay MISMATCH") << std::endl;
+       return match;
+   }
+   
+   void Game::beginRecording(Uint32 flags) {
+       if (recordPath.empty()) return;
+       recorder.begin(recordPath, seed, flags | (track->lanes << REPLAY_LANES_SHIFT));
+   }
+   
+   void Game::finishRecording() {
+       if (!recorder.isRecording()) return;
+       if (recorder.finish(simulationTick, computeStateHash())) {
+           std::cout << "Replay written to " << recordPath << " (" << simulationTick << " ticks)" << std::endl;
+       }
+   }
+   
+   /* Empreinte de tout ce qui influence la suite de la partie
+      (les positions flottantes sont comparées bit à bit) */
+   Uint64 Game::computeStateHash() const {
+       Uint64 hash = FNV_OFFSET;
+       const int state[] = {currentState, gameWon ? 1 : 0, tutorialState, tutorialsCompleted ? 1 : 0,
+                            getRemainingTime()};
+       hash = fnv1a(hash, state, sizeof(state));
+       hash = fnv1a(hash, &simulationTick, sizeof(simulationTick));
+   
+       if (velo) {
+           const int lane = race.getLane();
+           const int speed = race.getSpeed();
+           const float x = race.getX();
+           hash = fnv1a(hash, &lane, sizeof(lane));
+           hash = fnv1a(hash, &speed, sizeof(speed));
+           hash = fnv1a(hash, &x, sizeof(x));
+       }
+   
+       const ObstaclePool& obstacles = race.getWalls();
+       const size_t count = obstacles.size();
+       hash = fnv1a(hash, &count, sizeof(count));
+       for (size_t i = 0; i < count; i++) {
+           const int lane = obstacles.getLane(i);
+           const int x = obstacles.getX(i);
+           const float y = obstacles.getY(i);
+           hash = fnv1a(hash, &lane, sizeof(lane));
+           hash = fnv1a(hash, &x, sizeof(x));
+           hash = fnv1a(hash, &y, sizeof(y));
+       }
+   
+       const Uint64 rngState = rng.getState();
+       return fnv1a(hash, &rngState, sizeof(rngState));
+   }
+   
+   /* Le vélo, les murs et les obstacles lisent la piste à leur création */
+   void Game::setTrack(const TrackConfig& config) {
+       track = &config;
+       race.setTrack(config);
+   }
+   
+   /* Réinitialise les générateurs aléatoires à partir d'une graine */
+   void Game::setSeed(Uint64 seed) {
+       this->seed = seed;
+       rng.seed(seed, 1);
+       autopilotRng.seed(seed, 2);
+   }
+   
+   /* Active le suivi des allocations par image */
+   void Game::setAllocationTracking(bool enabled, bool test) {
+       allocationTracking = enabled || test;
+       allocationTest = test;
+       if (test && !AllocCounter::isEnabled()) {
+           std::cerr << "Allocation test: operator new is not counted in this build (NDEBUG), "
+                     << "only SDL allocations are checked" << std::endl;
+       }
+   }
+   
+   void Game::beginAllocationFrame() {
+       if (!allocationTracking) return;
+       allocationFrameState = currentState;
+       AllocCounter::beginFrame(currentState);
+   }
+   
+   /* Une image de PLAYING qui alloue après la montée en charge enfreint le budget */
+   void Game::endAllocationFrame(int warmupFrames) {
+       if (!allocationTracking) return;
+       Uint64 allocations = AllocCounter::endFrame();
+   
+       if (allocationFrameState != GameState::PLAYING) {
+           playingFrames = 0;
+           return;
+       }
+       if (++playingFrames <= warmupFrames || allocations == 0) return;
+   
+       // Seules les premières infractions sont détaillées
+       if (allocationTest && budgetViolations < 10) {
+           std::cerr << "Allocation budget exceeded: " << allocations << " allocations in PLAYING frame "
+                     << playingFrames << std::endl;
+       }
+       budgetViolations++;
+   }
+   
+   void Game::reportAllocations() {
+       if (!allocationTracking) return;
+       static const char* const stateNames[] = {"MENU", "PLAYING", "GAME_OVER", "EXIT"};
+       AllocCounter::printStats(stateNames, 4);
+   
+       if (allocationTest) {
+           if (budgetViolations == 0) {
+               std::cout << "Allocation test passed: no allocation in PLAYING after warm-up" << std::endl;
+           } else {
+               std::cout << "Allocation test FAILED: " << budgetViolations
+                         << " PLAYING frames allocated after warm-up" << std::endl;
+           }
+       }
+   }
+   
+   /* Active le profilage pour le thread principal */
+   void Game::setProfiling(bool enabled) {
+       Profiler::setEnabled(enabled);
+       Profiler::setThreadName("main");
+   }
+   
+   /* Démarre une nouvelle manche en sautant le tutoriel */
+   void Game::startHeadlessRound() {
+       changeState(GameState::PLAYING);
+       tutorialsCompleted = true;
+       tutorialState = TUTORIAL_NONE;
+   }
+   
+   /* Pilote automatique : changements de voie et de vitesse aléatoires
+      pour exercer les mêmes chemins de code qu'un joueur */
+   void Game::headlessInput() {
+       Uint32 choice = autopilotRng.nextBelow(64);
+       if (choice <= ACTION_SPEED_DOWN) {
+           performAction(static_cast<InputAction>(choice));
+       }
+   }
+   
+   void Game::performAction(InputAction action) {
+       recorder.record(simulationTick, action);
+       applyAction(action);
+   }
+   
+   /* Point d'entrée unique des actions du joueur, en direct comme en rejeu */
+   void Game::applyAction(InputAction action) {
+       switch (action) {
+           case ACTION_STATE_MENU:
+               changeState(GameState::MENU);
+               return;
+           case ACTION_STATE_PLAYING:
+               changeState(GameState::PLAYING);
+               return;
+           default:
+               break;
+       }
+       if (currentState != GameState::PLAYING) return;
+   
+       velo->applyAction(action);
+   
+       // Le tutoriel avance quand le joueur essaie la commande présentée
+       bool moves = action == ACTION_MOVE_LEFT || action == ACTION_MOVE_RIGHT;
+       bool speeds = action == ACTION_SPEED_UP || action == ACTION_SPEED_DOWN;
+       if ((tutorialState == TUTORIAL_CONTROLS && moves) || (tutorialState == TUTORIAL_SPEED && speeds)) {
+           advanceTutorial();
+       }
+   }
+   
+   /* Retourne le temps de simulation
+      Le minuteur, le tutoriel et la génération d'obstacles (Race) suivent cette horloge,
+      ce qui rend le jeu indépendant de la durée du rendu */
+   Uint32 Game::getTicks() const {
+       return static_cast<Uint32>(simulationTime);
+   }
+   
+   Uint32 Game::gameClock(void* game) {
+       return static_cast<Game*>(game)->getTicks();
    }
    
    /* Passe à l'étape suivante du tutoriel */
@@ -178,7 +682,7 @@ gestion des entités, rendu graphique et logique de jeu. */
        switch (tutorialState) {
            case TUTORIAL_CONTROLS:
                tutorialState = TUTORIAL_OBSTACLES;
-               spawnObstacle();
+               race.spawnSingleWall(rng);
                break;
            case TUTORIAL_OBSTACLES:
                tutorialState = TUTORIAL_SPEED;
@@ -191,7 +695,7 @@ gestion des entités, rendu graphique et logique de jeu. */
                tutorialState = TUTORIAL_NONE;
                break;
        }
-       tutorialStartTime = SDL_GetTicks();
+       tutorialStartTime = getTicks();
    }
    
    /* Gère les événements utilisateur */
@@ -202,37 +706,50 @@ gestion des entités, rendu graphique et logique de jeu. */
                isRunning = false;
            }
    
+           // Le contenu des textures cibles est perdu lors d'une réinitialisation du renderer
+           if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET ||
+               (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)) {
+               buildRoadLayer();
+           }
+   
+           // F3 : panneau de performances, F4 : figer le graphe et capturer l'historique
+           if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3) {
+               perfOverlay.toggle();
+           }
+           if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F4 && perfOverlay.isVisible()) {
+               perfOverlay.toggleCapture(FRAME_CAPTURE_PATH);
+               if (perfOverlay.isFrozen() && Profiler::isEnabled()) {
+                   Profiler::dumpChromeTrace(PROFILE_TRACE_PATH);
+               }
+           }
+   
+           // F12 : écriture immédiate de la trace du profileur
+           if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F12 && Profiler::isEnabled()) {
+               if (Profiler::dumpChromeTrace(PROFILE_TRACE_PATH)) {
+                   std::cout << "Profile trace written to " << PROFILE_TRACE_PATH << std::endl;
+               }
+           }
+   
            // Traitement des événements selon l'état du jeu
+           int previousState = currentState;
+           InputAction action;
            switch (currentState) {
                case GameState::MENU:
                    menu->handleEvents(event);
+                   // Le lancement d'une partie depuis le menu est enregistré comme action
+                   if (previousState != currentState && currentState == GameState::PLAYING) {
+                       recorder.record(simulationTick, ACTION_STATE_PLAYING);
+                   }
                    break;
                case GameState::PLAYING:
-                   velo->handleEvents(event);
-                   // Gestion des touches pour le tutoriel
-                   if (tutorialState != TUTORIAL_NONE && event.type == SDL_KEYDOWN) {
-                       switch (tutorialState) {
-                           case TUTORIAL_CONTROLS:
-                               if (event.key.keysym.sym == SDLK_LEFT || event.key.keysym.sym == SDLK_RIGHT) {
-                                   advanceTutorial();
-                               }
-                               break;
-                           case TUTORIAL_OBSTACLES:
-                               break;
-                           case TUTORIAL_SPEED:
-                               if (event.key.keysym.sym == SDLK_UP || event.key.keysym.sym == SDLK_DOWN) {
-                                   advanceTutorial();
-                               }
-                               break;
-                           default:
-                               break;
-                       }
+                   if (Entity::actionForEvent(event, action)) {
+                       performAction(action);
                    }
                    break;
                case GameState::GAME_OVER:
                    if (event.type == SDL_KEYDOWN) {
                        if (event.key.keysym.sym == SDLK_SPACE || event.key.keysym.sym == SDLK_RETURN) {
-                           changeState(GameState::MENU);
+                           performAction(ACTION_STATE_MENU);
                        }
                    }
                    break;
@@ -244,11 +761,11 @@ gestion des entités, rendu graphique et logique de jeu. */
    
    /* Met à jour l'état du jeu */
    void Game::update() {
-       Uint32 currentTime = SDL_GetTicks();
+       Uint32 currentTime = getTicks();
        
        switch (currentState) {
            case GameState::MENU:
-               menu->update();
+               if (menu) menu->update();
                break;
                
            case GameState::PLAYING:
@@ -258,45 +775,40 @@ gestion des entités, rendu graphique et logique de jeu. */
                    tutorialStartTime = currentTime;
                }
    
-               // Mise à jour du vélo
-               velo->update();
-   
-               // Mise à jour des obstacles
-               for (auto& obstacle : obstacles) {
-                   obstacle->update();
-               }
-               
-               // Suppression des obstacles sortis de l'écran
-               obstacles.erase(
-                   std::remove_if(obstacles.begin(), obstacles.end(),
-                       [this](const std::unique_ptr<Object>& o) {
-                           if (o->isOffScreen()) {
-                               if (tutorialState == TUTORIAL_OBSTACLES) {
-                                   advanceTutorial();
-                               }
-                               return true;
-                           }
-                           return false;
-                       }),
-                   obstacles.end()
-               );
-               
-               // Génération de nouveaux obstacles
-               if (tutorialsCompleted && currentTime - lastObstacleTime > 2000) {
-                   spawnObstacle();
-                   lastObstacleTime = currentTime;
+               {
+                   // Pas des règles : vélo, obstacles (vagues retenues pendant le tutoriel),
+                   // collision et fin du temps
+                   const Race::Outcome outcome = race.tick(rng, tutorialsCompleted);
+                   scrollRoad();
+                   
+                   // Le tutoriel avance quand l'obstacle présenté sort de l'écran
+                   if (race.getCulled() > 0 && tutorialState == TUTORIAL_OBSTACLES) {
+                       advanceTutorial();
+                   }
+                   
+                   if (outcome == Race::CRASHED) {
+                       playSound(SoundBank::SOUND_COLLISION);
+                       playSound(SoundBank::SOUND_GAME_OVER);
+                       currentState = GameState::GAME_OVER;
+                   } else if (outcome == Race::TIME_UP) {
+                       // Fin de jeu si le temps est écoulé (victoire)
+                       gameWon = true;
+                       currentState = GameState::GAME_OVER;
+                   }
                }
-               
-               // Vérification des collisions
-               checkCollisions();
                break;
        }
+   
+       // Bruit du vélo : vitesse publiée au thread audio, silence hors de la partie
+       bikeSound.setSpeed(currentState == GameState::PLAYING ? race.getSpeed() : 0);
    }
    
    /* Effectue le rendu graphique du jeu */
-   void Game::render() {
+   void Game::render(float alpha) {
+       PROFILE_SCOPE("render");
        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
        SDL_RenderClear(renderer);
+       spriteBatch.beginFrame();
    
        switch (currentState) {
            case GameState::MENU:
@@ -305,16 +817,13 @@ gestion des entités, rendu graphique et logique de jeu. */
                
            case GameState::PLAYING:
                // Affichage de la route
-               SDL_RenderCopy(renderer, roadTexture, NULL, NULL);
-               renderLanes();
+               renderRoad(alpha);
                
                // Affichage des obstacles
-               for (auto& obstacle : obstacles) {
-                   obstacle->render();
-               }
+               wall->render(race.getWalls(), alpha);
                
                // Affichage du vélo et des informations
-               velo->render();
+               velo->render(alpha);
                renderTimer();
                renderSpeedIndicator();
                
@@ -329,104 +838,235 @@ gestion des entités, rendu graphique et logique de jeu. */
                break;
        }
    
+       // Panneau de performances, par-dessus le HUD
+       if (perfOverlay.isVisible()) {
+           PerfOverlay::Counters counters = {spriteBatch.getLastDrawCalls(), race.getWalls().size(),
+                                             textureCache.getBytesResident()};
+           perfOverlay.render(spriteBatch, smallFontAtlas, counters);
+       }
+   
+       // Envoi des quads collectés, regroupés par couche et par texture
+       {
+           PROFILE_SCOPE("SpriteBatch::flush");
+           spriteBatch.flush(renderer);
+           spriteBatch.endFrame();
+       }
+   
+       PROFILE_SCOPE("SDL_RenderPresent");
        SDL_RenderPresent(renderer);
    }
    
    /* Affiche les instructions du tutoriel */
    void Game::renderTutorial() {
-       if (!smallFont) return;
+       if (!smallFontAtlas.isReady()) return;
    
        SDL_Color textColor = {255, 255, 255, 255};
        SDL_Color bgColor = {0, 0, 0, 180};
-       std::string tutorialText;
+       const char* tutorialText;
    
        // Sélection du texte selon l'état du tutoriel
        switch (tutorialState) {
            case TUTORIAL_CONTROLS:
-               tutorialText = "Utilisez les touches FLECHES pour changer de voie";
+               tutorialText = "Utilisez les touches FLÈCHES pour changer de voie";
                break;
            case TUTORIAL_OBSTACLES:
-               tutorialText = "Evitez les obstacles qui arrivent!";
+               tutorialText = "Évitez les obstacles qui arrivent!";
                break;
            case TUTORIAL_SPEED:
-               tutorialText = "Maintenez la touche HAUT ou BAS pour accelerer";
+               tutorialText = "Maintenez la touche HAUT ou BAS pour accélérer";
                break;
            default:
                return;
        }
    
-       // Rendu du texte du tutoriel
-       SDL_Surface* surface = TTF_RenderText_Solid(smallFont, tutorialText.c_str(), textColor);
-       SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-   
        // Configuration de la boîte de tutoriel
-       int boxWidth = surface->w + 40;
-       int boxHeight = surface->h + 20;
+       int textWidth, textHeight;
+       smallFontAtlas.measureText(tutorialText, &textWidth, &textHeight);
+       int boxWidth = textWidth + 40;
+       int boxHeight = textHeight + 20;
        int boxX = (WINDOW_WIDTH - boxWidth) / 2;
        int boxY = 100;
    
        // Rendu de l'arrière-plan
        SDL_Rect bgRect = {boxX, boxY, boxWidth, boxHeight};
-       SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-       SDL_RenderFillRect(renderer, &bgRect);
+       spriteBatch.fillRect(bgRect, bgColor, LAYER_HUD);
    
        // Rendu du texte
-       SDL_Rect textRect = {boxX + 20, boxY + 10, surface->w, surface->h};
-       SDL_RenderCopy(renderer, texture, NULL, &textRect);
-   
-       // Libération des ressources
-       SDL_FreeSurface(surface);
-       SDL_DestroyTexture(texture);
+       smallFontAtlas.drawText(spriteBatch, tutorialText, boxX + 20, boxY + 10, textColor, LAYER_HUD_TEXT);
    }
    
    /* Affiche les lignes de voie sur la route */
-   void Game::renderLanes() {
+   void Game::renderLanes(int scrollOffset) {
        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
        
-       // Dessin des lignes de voie en pointillés
-       for (int i = 1; i < LANES; i++) {
-           int x = i * (WINDOW_WIDTH / LANES);
+       // Dessin des lignes de voie en pointillés (période de 40 pixels)
+       for (int i = 1; i < track->lanes; i++) {
+           int x = i * track->laneWidth;
            
-           for (int y = 0; y < WINDOW_HEIGHT; y += 40) {
+           for (int y = scrollOffset % 40 - 40; y < WINDOW_HEIGHT; y += 40) {
                SDL_Rect lineRect = {x - 2, y, 4, 20};
                SDL_RenderFillRect(renderer, &lineRect);
            }
        }
    }
    
+   const char* Game::getRoadTexturePath() const {
+       return track->lanes == LANES ? ROAD_TEXTURE_PATH : PLAIN_ROAD_TEXTURE_KEY;
+   }
+   
+   SDL_Surface* Game::createPlainRoadSurface() const {
+       SDL_Surface* surface = SDL_CreateRGBSurface(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, 0, 0, 0, 0);
+       if (!surface) return surface;
+       SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 80, 80, 80));
+       
+       // Ajout des lignes de voie
+       const int laneWidth = track->laneWidth;
+       for (int i = 1; i < track->lanes; i++) {
+           SDL_Rect lineRect = {i * laneWidth - 2, 0, 4, WINDOW_HEIGHT};
+           SDL_FillRect(surface, &lineRect, SDL_MapRGB(surface->format, 255, 255, 0));
+       }
+       return surface;
+   }
+   
+   /* Pré-compose la couche de route
+      La route (mise à l'échelle) et la trentaine de rectangles de lignes sont
+      dessinés une seule fois au lieu de l'être à chaque image */
+   bool Game::buildRoadLayer() {
+       if (roadLayer) {
+           SDL_DestroyTexture(roadLayer);
+           roadLayer = nullptr;
+       }
+       if (!renderer || !SDL_RenderTargetSupported(renderer)) return false;
+   
+       roadLayer = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                     WINDOW_WIDTH, WINDOW_HEIGHT);
+       if (!roadLayer) {
+           std::cerr << "Road layer creation failed: " << SDL_GetError() << std::endl;
+           return false;
+       }
+   
+       SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+       SDL_SetRenderTarget(renderer, roadLayer);
+       SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+       SDL_RenderClear(renderer);
+       SDL_RenderCopy(renderer, roadTexture, NULL, NULL);
+       renderLanes(0);
+       SDL_SetRenderTarget(renderer, previousTarget);
+       return true;
+   }
+   
+   /* Fait défiler la route à la même vitesse que les obstacles */
+   void Game::scrollRoad() {
+       const int speed = wall->getSpeed() + (race.getSpeed() / 2) * VELO_SPEED_SCALE;
+       prevRoadScroll = roadScroll;
+       roadScroll += speed * SIM_DT;
+   
+       // Repli dans [0, WINDOW_HEIGHT) en gardant l'écart avec le pas précédent
+       if (roadScroll >= WINDOW_HEIGHT) {
+           roadScroll -= WINDOW_HEIGHT;
+           prevRoadScroll -= WINDOW_HEIGHT;
+       }
+   }
+   
+   /* Dessine la route défilante
+      La couche pré-composée est enroulée verticalement : deux copies par image,
+      quel que soit le décalage, sans redessiner les lignes de voie.
+      Repli sur le rendu direct si la couche n'existe pas */
+   void Game::renderRoad(float alpha) {
+       float scroll = prevRoadScroll + (roadScroll - prevRoadScroll) * alpha;
+       if (scroll < 0.0f) scroll += WINDOW_HEIGHT;
+       int offset = static_cast<int>(scroll) % WINDOW_HEIGHT;
+   
+       if (roadLayer) {
+           // Partie haute de la couche, décalée vers le bas
+           SDL_Rect lowerSrc = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT - offset};
+           SDL_Rect lowerDst = {0, offset, WINDOW_WIDTH, WINDOW_HEIGHT - offset};
+           spriteBatch.draw(roadLayer, &lowerSrc, lowerDst, LAYER_ROAD);
+   
+           // Partie basse de la couche, réapparaissant en haut de l'écran
+           if (offset > 0) {
+               SDL_Rect upperSrc = {0, WINDOW_HEIGHT - offset, WINDOW_WIDTH, offset};
+               SDL_Rect upperDst = {0, 0, WINDOW_WIDTH, offset};
+               spriteBatch.draw(roadLayer, &upperSrc, upperDst, LAYER_ROAD);
+           }
+       } else {
+           // Dessin direct : passe sous tout le contenu de la file de rendu
+           SDL_RenderCopy(renderer, roadTexture, NULL, NULL);
+           renderLanes(offset);
+       }
+   }
+   
    /* Affiche l'indicateur de vitesse */
    void Game::renderSpeedIndicator() {
-       if (smallFont) {
+       if (smallFontAtlas.isReady()) {
            SDL_Color textColor = {255, 255, 255, 255};
-           std::string speedText = "Vitesse: " + std::to_string(velo->getSpeed());
-           
-           // Rendu du texte
-           SDL_Surface* surface = TTF_RenderText_Solid(smallFont, speedText.c_str(), textColor);
-           SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+           char speedText[32];
+           SDL_snprintf(speedText, sizeof(speedText), "Vitesse: %d", race.getSpeed());
            
            // Positionnement en bas à droite
-           SDL_Rect destRect = {WINDOW_WIDTH - surface->w - 20, WINDOW_HEIGHT - surface->h - 20, surface->w, surface->h};
-           SDL_RenderCopy(renderer, texture, NULL, &destRect);
-           
-           // Libération des ressources
-           SDL_FreeSurface(surface);
-           SDL_DestroyTexture(texture);
+           int textWidth, textHeight;
+           smallFontAtlas.measureText(speedText, &textWidth, &textHeight);
+           smallFontAtlas.drawText(spriteBatch, speedText, WINDOW_WIDTH - textWidth - 20, WINDOW_HEIGHT - textHeight - 20, textColor, LAYER_HUD_TEXT);
        }
    }
    
    /* Libère toutes les ressources utilisées par le jeu */
    void Game::cleanup() {
-       // Libération des ressources audio
-       if (menuMusic) Mix_FreeMusic(menuMusic);
-       if (gameMusic) Mix_FreeMusic(gameMusic);
+       spriteBatch.printStats();
+   
+       // Bilan du cache : en régime établi, les misses ne doivent plus augmenter
+       if (textureCache.getHits() + textureCache.getMisses() > 0) {
+           std::cout << "Texture cache: " << textureCache.getHits() << " hits, "
+                     << textureCache.getMisses() << " misses, "
+                     << textureCache.getBytesResident() / 1024 << " KiB resident" << std::endl;
+       }
+   
+       // Libération des entités avant le cache de textures qu'elles empruntent
+       wall.reset();
+       velo.reset();
+       menu.reset();
+   
+       // Bilan et arrêt du moteur de musique (avant la fermeture du périphérique audio)
+       if (music.isRunning()) {
+           std::cout << "Music: " << music.getUnderruns() << " underruns, "
+                     << music.getMissingSamples() << " samples of silence inserted" << std::endl;
+       }
+       music.stop();
+   
+       // Latence mesurée des effets sonores, pour régler --audio-buffer
+       if (sounds.getLatencyCount() > 0) {
+           std::cout << "Sound effects: " << sounds.getLatencyCount() << " played, trigger-to-output latency "
+                     << sounds.getAverageLatencyMs() << " ms average, " << sounds.getMaxLatencyMs()
+                     << " ms max (buffer " << audioBufferSize << " samples)" << std::endl;
+       }
+       sounds.unload();
+   
+       // Charge de la synthèse du vélo (part d'un cœur)
+       if (bikeSound.isRunning()) {
+           std::cout << "Bike synth: " << bikeSound.getLoad() * 100.0 << "% of one core" << std::endl;
+       }
+       bikeSound.stop();
        Mix_CloseAudio();
    
        // Libération des textures et polices
-       if (roadTexture) SDL_DestroyTexture(roadTexture);
+       if (roadLayer) SDL_DestroyTexture(roadLayer);
+       roadLayer = nullptr;
+       if (roadTexture) textureCache.release(getRoadTexturePath());
+       roadTexture = nullptr;
+       textureCache.clear();
+       fontAtlas.destroy();
+       smallFontAtlas.destroy();
        if (font) TTF_CloseFont(font);
        if (smallFont) TTF_CloseFont(smallFont);
        if (renderer) SDL_DestroyRenderer(renderer);
        if (window) SDL_DestroyWindow(window);
+       font = nullptr;
+       smallFont = nullptr;
+       renderer = nullptr;
+       window = nullptr;
+   
+       // Les polices et musiques ouvertes depuis l'archive sont fermées : fin de la projection
+       assetArchive.close();
    
        // Fermeture des bibliothèques SDL
        TTF_Quit();
@@ -438,24 +1078,20 @@ gestion des entités, rendu graphique et logique de jeu. */
    void Game::changeState(int newState) {
        if (newState == GameState::PLAYING) {
            // Réinitialisation pour une nouvelle partie
-           obstacles.clear();
-           velo->reset();
+           race.start();
            gameWon = false;
-           lastObstacleTime = SDL_GetTicks();
-           gameTimer.start(GAME_TIME);
            
            // Configuration du tutoriel
            tutorialsCompleted = false;
            tutorialState = TUTORIAL_CONTROLS;
-           tutorialStartTime = SDL_GetTicks();
-           playMusic(gameMusic);
+           tutorialStartTime = getTicks();
+           playMusic(MusicEngine::TRACK_GAME);
        }
        else if (newState == GameState::MENU) {
-           Mix_HaltMusic();
-           menu->playMenuMusic();
+           if (menu) menu->playMenuMusic();
        }
        else if (newState == GameState::GAME_OVER) {
-           Mix_HaltMusic();
+           playMusic(MusicEngine::TRACK_NONE);
        }
        else if (newState == GameState::EXIT) {
            isRunning = false;
@@ -465,171 +1101,81 @@ gestion des entités, rendu graphique et logique de jeu. */
        currentState = newState;
    }
    
-   /* Vérifie s'il y a collision entre deux rectangles */
-   bool Game::checkCollision(const SDL_Rect& a, const SDL_Rect& b) const {
-       return (a.x < b.x + b.w && a.x + a.w > b.x && a.y < b.y + b.h && a.y + a.h > b.y);
-   }
-   
-   /* Démarre le compte à rebours du jeu */
-   void Game::startTimer(int seconds) {
-       gameTimer.start(seconds);
-   }
-   
    /* Obtient le temps restant du compte à rebours */
    int Game::getRemainingTime() const {
-       return gameTimer.getRemainingTime();
+       return race.getRemainingTime();
    }
    
    /* Vérifie si le temps est écoulé */
    bool Game::isTimeUp() const {
-       return gameTimer.isTimeUp();
-   }
-   
-   /* Génère de nouveaux obstacles */
-   void Game::spawnObstacle() {
-       const int numLanes = 3;
-   
-       if (tutorialState == TUTORIAL_OBSTACLES) {
-           // Un seul obstacle aléatoire pour le tutoriel
-           int lane = rand() % numLanes;
-           int verticalOffset = -70;
-           obstacles.push_back(std::make_unique<Object>(this, lane, verticalOffset));
-       } else {
-           // Génération multiple d'obstacles avec positions décalées
-           for (int lane = 0; lane < numLanes; ++lane) {
-               int verticalOffset = -70 - (rand() % 100) - (lane * 100);
-               obstacles.push_back(std::make_unique<Object>(this, lane, verticalOffset));
-           }
-           // Mélange des obstacles pour plus d'aléatoire
-           std::random_device rd;
-           std::mt19937 g(rd());
-           std::shuffle(obstacles.begin(), obstacles.end(), g);
-       }
-   }
-   
-   /* Vérifie les collisions entre le vélo et les obstacles */
-   void Game::checkCollisions() {
-       SDL_Rect veloRect = velo->getCollisionBox();
-   
-       // Vérification des collisions avec tous les obstacles
-       for (auto& obstacle : obstacles) {
-           SDL_Rect obstacleRect = obstacle->getCollisionBox();
-           
-           if (checkCollision(veloRect, obstacleRect)) {
-               currentState = GameState::GAME_OVER;
-               return;
-           }
-       }
-   
-       // Fin de jeu si le temps est écoulé (victoire)
-       if (getRemainingTime() <= 0) {
-           gameWon = true;
-           currentState = GameState::GAME_OVER;
-       }
+       return race.isTimeUp();
    }
    
    /* Affiche le temps restant */
    void Game::renderTimer() {
-       if (font) {
+       if (fontAtlas.isReady()) {
            SDL_Color textColor = {255, 255, 255, 255};
            int totalSeconds = getRemainingTime();
            int minutes = totalSeconds / 60;
            int seconds = totalSeconds % 60;
            
-           // Formatage du texte MM:SS avec padding de zéros
-           std::string timeText = "Temps: ";
-           timeText += (minutes < 10) ? "0" : "";
-           timeText += std::to_string(minutes);
-           timeText += ":";
-           timeText += (seconds < 10) ? "0" : "";
-           timeText += std::to_string(seconds);
+           // Formatage du texte MM:SS avec padding de zéros (tampon sur la pile)
+           char timeText[32];
+           SDL_snprintf(timeText, sizeof(timeText), "Temps: %02d:%02d", minutes, seconds);
            
-           // Rendu du texte
-           SDL_Surface* surface = TTF_RenderText_Solid(font, timeText.c_str(), textColor);
-           SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-           
-           SDL_Rect destRect = {20, 20, surface->w, surface->h};
-           SDL_RenderCopy(renderer, texture, NULL, &destRect);
-           
-           // Libération des ressources
-           SDL_FreeSurface(surface);
-           SDL_DestroyTexture(texture);
+           fontAtlas.drawText(spriteBatch, timeText, 20, 20, textColor, LAYER_HUD_TEXT);
        }
    }
    
    /* Affiche l'écran de fin de jeu */
    void Game::renderGameOver() {
        // Affichage du fond de jeu
-       SDL_RenderCopy(renderer, roadTexture, NULL, NULL);
-       renderLanes();
+       renderRoad(1.0f);
    
-       for (auto& obstacle : obstacles) {
-           obstacle->render();
-       }
+       // La simulation est arrêtée : positions du dernier pas, sans interpolation
+       wall->render(race.getWalls(), 1.0f);
    
-       velo->render();
+       velo->render(1.0f);
    
        // Overlay semi-transparent
-       SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
-       SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
        SDL_Rect overlay = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
-       SDL_RenderFillRect(renderer, &overlay);
+       spriteBatch.fillRect(overlay, SDL_Color{0, 0, 0, 180}, LAYER_OVERLAY);
    
-       if (font) {
+       if (fontAtlas.isReady()) {
            // Message différent selon victoire ou défaite
-           std::string message = gameWon ? "VICTOIRE!" : "PARTIE TERMINEE";
+           const char* message = gameWon ? "VICTOIRE!" : "PARTIE TERMINÉE";
            SDL_Color messageColor = gameWon ? SDL_Color{255, 215, 0, 255} : SDL_Color{255, 0, 0, 255};
            
-           // Rendu du message principal
-           SDL_Surface* surface = TTF_RenderText_Solid(font, message.c_str(), messageColor);
-           SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-           
+           // Position du message principal
+           int messageWidth, messageHeight;
+           fontAtlas.measureText(message, &messageWidth, &messageHeight);
            SDL_Rect destRect = {
-               (WINDOW_WIDTH - surface->w) / 2, 
-               (WINDOW_HEIGHT - surface->h) / 2 - 40, 
-               surface->w, 
-               surface->h
+               (WINDOW_WIDTH - messageWidth) / 2, 
+               (WINDOW_HEIGHT - messageHeight) / 2 - 40, 
+               messageWidth, 
+               messageHeight
            };
            
            // Effet de lueur autour du texte
+           SDL_Color glowColor = {messageColor.r, messageColor.g, messageColor.b, 50};
            for (int i = 5; i > 0; i--) {
-               SDL_SetRenderDrawColor(renderer, messageColor.r, messageColor.g, messageColor.b, 50);
                SDL_Rect glowRect = {
                    destRect.x - i * 2, 
                    destRect.y - i * 2, 
                    destRect.w + i * 4, 
                    destRect.h + i * 4
                };
-               SDL_RenderFillRect(renderer, &glowRect);
+               spriteBatch.fillRect(glowRect, glowColor, LAYER_OVERLAY);
            }
            
-           SDL_RenderCopy(renderer, texture, NULL, &destRect);
+           fontAtlas.drawText(spriteBatch, message, destRect.x, destRect.y, messageColor, LAYER_OVERLAY_TEXT);
            
            // Instructions pour revenir au menu
            SDL_Color instructionColor = {192, 192, 192, 255};
-           std::string instruction = "Appuyez sur ESPACE pour revenir au menu";
-           
-           SDL_Surface* instrSurface = TTF_RenderText_Solid(smallFont, instruction.c_str(), instructionColor);
-           SDL_Texture* instrTexture = SDL_CreateTextureFromSurface(renderer, instrSurface);
-           
-           SDL_Rect instrRect = {
-               (WINDOW_WIDTH - instrSurface->w) / 2, 
-               destRect.y + destRect.h + 40, 
-               instrSurface->w, 
-               instrSurface->h
-           };
-           
-           SDL_RenderCopy(renderer, instrTexture, NULL, &instrRect);
+           const char* instruction = "Appuyez sur ESPACE pour revenir au menu";
            
-           // Libération des ressources
-           SDL_FreeSurface(surface);
-           SDL_DestroyTexture(texture);
-           SDL_FreeSurface(instrSurface);
-           SDL_DestroyTexture(instrTexture);
+           int instrWidth;
+           smallFontAtlas.measureText(instruction, &instrWidth, nullptr);
+           smallFontAtlas.drawText(spriteBatch, instruction, (WINDOW_WIDTH - instrWidth) / 2, destRect.y + destRect.h + 40, instructionColor, LAYER_OVERLAY_TEXT);
        }
    }
-   
-   /* Retourne la vitesse actuelle du vélo */
-   int Game::getVeloSpeed() const {
-       return velo->getSpeed();
-   }
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "../headers/glyphatlas.hpp"
+#include <iostream>
+
+/*
+Atlas de glyphes pour le texte du HUD
+Remplace les appels TTF_RenderText_* effectués à chaque image : la police est
+rastérisée une seule fois au chargement, puis chaque chaîne devient une liste
+de quads texturés regroupés par la file de rendu.
+*/
+
+namespace {
+    // Largeur de l'atlas (la hauteur dépend de la taille de la police)
+    const int ATLAS_WIDTH = 512;
+    const int GLYPH_PADDING = 1;
+
+    // Caractères hors Latin-1 utiles pour le français
+    const Uint32 EXTRA_CODEPOINTS[] = {0x0152, 0x0153, 0x2019, 0x20AC};
+}
+
+GlyphAtlas::GlyphAtlas() :
+    texture(nullptr),
+    atlasWidth(0),
+    atlasHeight(0),
+    lineHeight(0),
+    fallbackIndex(0) {
+    for (int& index : latinIndex) index = -1;
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    destroy();
+}
+
+void GlyphAtlas::destroy() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    glyphs.clear();
+    kerning.clear();
+    for (int& index : latinIndex) index = -1;
+}
+
+/*
+Construit l'atlas
+Les glyphes sont rangés par étagères (rangées de hauteur fixe) dans une surface RGBA
+puis la surface est envoyée une seule fois au GPU
+*/
+bool GlyphAtlas::build(SDL_Renderer* renderer, TTF_Font* font) {
+    destroy();
+    if (!renderer || !font) return false;
+
+    // Liste des codepoints fournis par la police
+    std::vector<Uint32> codepoints;
+    for (Uint32 c = 32; c < 256; c++) {
+        if (c >= 127 && c < 160) continue;  // Caractères de contrôle
+        codepoints.push_back(c);
+    }
+    for (Uint32 c : EXTRA_CODEPOINTS) codepoints.push_back(c);
+
+    lineHeight = TTF_FontHeight(font);
+    SDL_Color white = {255, 255, 255, 255};
+
+    // Rastérisation et placement de chaque glyphe
+    std::vector<SDL_Surface*> surfaces;
+    int penX = GLYPH_PADDING;
+    int penY = GLYPH_PADDING;
+    int rowHeight = lineHeight;
+    for (Uint32 c : codepoints) {
+        if (!TTF_GlyphIsProvided32(font, c)) continue;
+
+        int minx, maxx, miny, maxy, advance;
+        if (TTF_GlyphMetrics32(font, c, &minx, &maxx, &miny, &maxy, &advance) != 0) continue;
+
+        // Les espaces n'ont pas de pixels : seule l'avance compte
+        SDL_Surface* surface = (c == ' ' || c == 0xA0) ? nullptr : TTF_RenderGlyph32_Blended(font, c, white);
+        int w = surface ? surface->w : 0;
+        int h = surface ? surface->h : 0;
+
+        if (penX + w + GLYPH_PADDING > ATLAS_WIDTH) {
+            penX = GLYPH_PADDING;
+            penY += rowHeight + GLYPH_PADDING;
+            rowHeight = lineHeight;
+        }
+        if (h > rowHeight) rowHeight = h;
+
+        Glyph glyph;
+        glyph.codepoint = c;
+        glyph.src = {penX, penY, w, h};
+        glyph.xOffset = minx < 0 ? minx : 0;
+        glyph.advance = advance;
+        glyphs.push_back(glyph);
+        surfaces.push_back(surface);
+
+        penX += w + GLYPH_PADDING;
+    }
+
+    if (glyphs.empty()) {
+        std::cerr << "Aucun glyphe disponible pour l'atlas" << std::endl;
+        return false;
+    }
+
+    atlasWidth = ATLAS_WIDTH;
+    atlasHeight = penY + rowHeight + GLYPH_PADDING;
+
+    // Copie des glyphes dans la surface de l'atlas
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!atlas) {
+        std::cerr << "Échec de création de la surface de l'atlas: " << SDL_GetError() << std::endl;
+        for (SDL_Surface* surface : surfaces) SDL_FreeSurface(surface);
+        glyphs.clear();
+        return false;
+    }
+    SDL_FillRect(atlas, nullptr, SDL_MapRGBA(atlas->format, 255, 255, 255, 0));
+
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        SDL_Surface* surface = surfaces[i];
+        if (!surface) continue;
+        // Copie brute pour conserver le canal alpha du glyphe
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+        SDL_Rect dest = glyphs[i].src;
+        SDL_BlitSurface(surface, nullptr, atlas, &dest);
+        SDL_FreeSurface(surface);
+    }
+
+    texture = SDL_CreateTextureFromSurface(renderer, atlas);
+    SDL_FreeSurface(atlas);
+    if (!texture) {
+        std::cerr << "Échec de création de la texture de l'atlas: " << SDL_GetError() << std::endl;
+        glyphs.clear();
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    // Tables de correspondance et de crénage
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        if (glyphs[i].codepoint < 256) latinIndex[glyphs[i].codepoint] = static_cast<int>(i);
+    }
+    fallbackIndex = latinIndex['?'] >= 0 ? latinIndex['?'] : 0;
+
+    const size_t count = glyphs.size();
+    kerning.assign(count * count, 0);
+    if (TTF_GetFontKerning(font)) {
+        for (size_t a = 0; a < count; a++) {
+            for (size_t b = 0; b < count; b++) {
+                int k = TTF_GetFontKerningSizeGlyphs32(font, glyphs[a].codepoint, glyphs[b].codepoint);
+                kerning[a * count + b] = static_cast<Sint8>(SDL_clamp(k, -128, 127));
+            }
+        }
+    }
+
+    return true;
+}
+
+int GlyphAtlas::findGlyph(Uint32 codepoint) const {
+    if (codepoint < 256) {
+        int index = latinIndex[codepoint];
+        return index >= 0 ? index : fallbackIndex;
+    }
+    // Les extras sont rangés après le bloc Latin-1
+    for (size_t i = glyphs.size(); i-- > 0 && glyphs[i].codepoint >= 256;) {
+        if (glyphs[i].codepoint == codepoint) return static_cast<int>(i);
+    }
+    return fallbackIndex;
+}
+
+/*
+Décode un caractère UTF-8
+Les séquences invalides sont remplacées par '?'
+*/
+Uint32 GlyphAtlas::nextCodepoint(const char*& text) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(text);
+    Uint32 c = p[0];
+    int length = 1;
+
+    if (c >= 0xF0) { c &= 0x07; length = 4; }
+    else if (c >= 0xE0) { c &= 0x0F; length = 3; }
+    else if (c >= 0xC0) { c &= 0x1F; length = 2; }
+    else if (c >= 0x80) { text++; return '?'; }
+
+    for (int i = 1; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            text += i;
+            return '?';
+        }
+        c = (c << 6) | (p[i] & 0x3F);
+    }
+    text += length;
+    return c;
+}
+
+/*
+Ajoute une chaîne à la file de rendu
+Un quad par glyphe visible, tous avec la texture de l'atlas
+*/
+void GlyphAtlas::drawText(SpriteBatch& batch, const char* text, int x, int y, SDL_Color color, int layer) {
+    if (!texture || !text) return;
+
+    const size_t count = glyphs.size();
+    const float invW = 1.0f / atlasWidth;
+    const float invH = 1.0f / atlasHeight;
+    int penX = x;
+    int previous = -1;
+
+    while (*text) {
+        int index = findGlyph(nextCodepoint(text));
+        const Glyph& glyph = glyphs[index];
+
+        if (previous >= 0) penX += kerning[previous * count + index];
+        previous = index;
+
+        if (glyph.src.w > 0) {
+            float x0 = static_cast<float>(penX + glyph.xOffset);
+            float y0 = static_cast<float>(y);
+            batch.addQuad(texture, layer,
+                          x0, y0, x0 + glyph.src.w, y0 + glyph.src.h,
+                          glyph.src.x * invW, glyph.src.y * invH,
+                          (glyph.src.x + glyph.src.w) * invW, (glyph.src.y + glyph.src.h) * invH,
+                          color);
+        }
+        penX += glyph.advance;
+    }
+}
+
+void GlyphAtlas::measureText(const char* text, int* w, int* h) const {
+    int width = 0;
+    if (texture && text) {
+        const size_t count = glyphs.size();
+        int previous = -1;
+        while (*text) {
+            int index = findGlyph(nextCodepoint(text));
+            if (previous >= 0) width += kerning[previous * count + index];
+            width += glyphs[index].advance;
+            previous = index;
+        }
+    }
+    if (w) *w = width;
+    if (h) *h = lineHeight;
+}
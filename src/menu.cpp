@@ -1,5 +1,6 @@
 #include "../headers/menu.hpp"
 #include "../headers/game.hpp"
+#include "../headers/profiler.hpp"
 #include <iostream>
 
 Menu::Menu(Game* game) : 
@@ -27,7 +28,7 @@ Menu::Menu(Game* game) :
     createOptionTextures();
     
     // Stocker le volume initial actuel
-    initialMusicVolume = Mix_VolumeMusic(-1); // Récupérer le volume actuel
+    initialMusicVolume = game->getMusic().getVolume(); // Récupérer le volume actuel
 }
 
 Menu::~Menu() {
@@ -39,9 +40,9 @@ Menu::~Menu() {
         }
     }
     
-    // Nettoyer la texture d'arrière-plan
+    // Rendre la texture d'arrière-plan au cache
     if (backgroundTexture) {
-        SDL_DestroyTexture(backgroundTexture);
+        game->getTextureCache().release(MENU_BACKGROUND_PATH);
         backgroundTexture = nullptr;
     }
     
@@ -72,8 +73,7 @@ void Menu::handleEvents(SDL_Event& event) {
                 break;
             case SDLK_RETURN:
             case SDLK_SPACE:
-                // Arrêter la musique avant de changer d'état
-                Mix_HaltMusic();
+                // La musique n'est plus coupée : le changement d'état l'enchaîne en fondu
                 isMusicPlaying = false;
                 // Action en fonction de l'option sélectionnée
                 switch (static_cast<MenuOption>(selectedOption)) {
@@ -98,7 +98,8 @@ void Menu::handleEvents(SDL_Event& event) {
 
 void Menu::update() {
     // Mise à jour de l'effet de pulsation pour l'option sélectionnée
-    highlightPulse += pulseDirection;
+    // (60 unités par seconde, quelle que soit la fréquence de simulation)
+    highlightPulse += pulseDirection * 60.0f * SIM_DT;
     
     if (highlightPulse >= 30) {
         pulseDirection = -1;
@@ -135,17 +136,15 @@ void Menu::render() {
 }
 
 void Menu::playMenuMusic() {
-    game->playMusic(game->getMenuMusic()); // Utiliser le getter
+    game->playMusic(MusicEngine::TRACK_MENU); // Sans effet si elle est déjà en cours
 }
 
 void Menu::loadBackgroundTexture() {
-    SDL_Surface* surface = IMG_Load("assets/menubackg.png");
-    
-    if (!surface) {
-        std::cerr << "Failed to load menu background! Error: " << IMG_GetError() << std::endl;
-        
+    PROFILE_SCOPE("Menu::loadBackgroundTexture");
+    backgroundTexture = game->getTextureCache().acquire(MENU_BACKGROUND_PATH, []() {
         // Créer une surface de secours avec un dégradé
-        surface = SDL_CreateRGBSurface(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, 0, 0, 0, 0);
+        SDL_Surface* surface = SDL_CreateRGBSurface(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, 0, 0, 0, 0);
+        if (!surface) return surface;
         
         // Créer un dégradé de couleurs
         for (int y = 0; y < WINDOW_HEIGHT; y++) {
@@ -157,10 +156,8 @@ void Menu::loadBackgroundTexture() {
             SDL_Rect lineRect = {0, y, WINDOW_WIDTH, 1};
             SDL_FillRect(surface, &lineRect, SDL_MapRGB(surface->format, r, g, b));
         }
-    }
-    
-    backgroundTexture = SDL_CreateTextureFromSurface(game->getRenderer(), surface);
-    SDL_FreeSurface(surface);
+        return surface;
+    });
 }
 
 void Menu::createOptionTextures() {
@@ -236,7 +233,7 @@ void Menu::renderOption(int index) {
     // Si c'est l'option sélectionnée, ajouter des effets
     if (index == selectedOption) {
         // Effet de pulsation
-        int pulse = highlightPulse / 3;
+        int pulse = static_cast<int>(highlightPulse) / 3;
         destRect.x -= pulse;
         destRect.y -= pulse / 2;
         destRect.w += pulse * 2;
@@ -264,7 +261,7 @@ void Menu::showAboutScreen() {
         isMusicPlaying = true;
     }
     // Réduire le volume à 50% au lieu de 20% pour s'assurer qu'il est audible
-    Mix_VolumeMusic(initialMusicVolume / 2); // 50% du volume initial
+    game->getMusic().setVolume(initialMusicVolume / 2); // 50% du volume initial
     
     // Créer la texture de l'écran À propos si elle n'existe pas
     if (!aboutTexture) {
@@ -336,7 +333,7 @@ void Menu::showAboutScreen() {
 void Menu::hideAboutScreen() {
     showingAbout = false;
     // Restaurer le volume initial
-    Mix_VolumeMusic(initialMusicVolume);
+    game->getMusic().setVolume(initialMusicVolume);
 }
 
 void Menu::renderAboutScreen() {
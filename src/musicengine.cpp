@@ -0,0 +1,240 @@
+#include "../headers/musicengine.hpp"
+#include "../headers/profiler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+MusicEngine::MusicEngine() :
+    running(false),
+    requested(TRACK_NONE),
+    volume(MIX_MAX_VOLUME),
+    ringSamples(0),
+    readPos(0),
+    writePos(0),
+    streaming(false),
+    underruns(0),
+    missingSamples(0),
+    channels(2),
+    frequency(MIX_DEFAULT_FREQUENCY),
+    current(TRACK_NONE),
+    currentPos(0),
+    previous(TRACK_NONE),
+    previousPos(0),
+    fadeFrames(0),
+    fadeLength(1)
+{
+    for (int track = 0; track < TRACK_COUNT; track++) {
+        chunks[track].store(nullptr);
+        ready[track].store(false);
+        pending[track] = nullptr;
+    }
+}
+
+MusicEngine::~MusicEngine() {
+    stop();
+}
+
+bool MusicEngine::start(SDL_RWops* sources[TRACK_COUNT], int bufferFrames) {
+    stop();
+
+    Uint16 format = 0;
+    if (!Mix_QuerySpec(&frequency, &format, &channels) || format != AUDIO_S16SYS) {
+        std::cerr << "Music engine: unsupported audio format" << std::endl;
+        for (int track = 0; track < TRACK_COUNT; track++) {
+            if (sources[track]) SDL_RWclose(sources[track]);
+        }
+        return false;
+    }
+
+    for (int track = 0; track < TRACK_COUNT; track++) {
+        pending[track] = sources[track];
+        chunks[track].store(nullptr);
+        ready[track].store(!sources[track]);
+    }
+
+    // Quelques blocs du périphérique ou périodes de réveil, le plus long des deux :
+    // assez pour ne pas manquer d'échantillons, assez court pour que les fondus
+    // et le volume, appliqués au remplissage, s'entendent sans retard notable
+    const size_t periodFrames = std::max<size_t>(bufferFrames, FILL_PERIOD_MS * frequency / 1000);
+    ringSamples = 1;
+    while (ringSamples < periodFrames * RING_PERIODS * channels) ringSamples <<= 1;
+    ring.assign(ringSamples, 0);
+    mixBuffer.assign(ringSamples, 0);
+    readPos.store(0);
+    writePos.store(0);
+    streaming.store(false);
+    underruns.store(0);
+    missingSamples.store(0);
+    current = TRACK_NONE;
+    previous = TRACK_NONE;
+    fadeFrames = 0;
+    fadeLength = std::max(1, CROSSFADE_MS * frequency / 1000);
+
+    running.store(true);
+    decoder = std::thread(&MusicEngine::decodeLoop, this);
+    thread = std::thread(&MusicEngine::mixLoop, this);
+    Mix_HookMusic(&MusicEngine::hook, this);
+    return true;
+}
+
+void MusicEngine::stop() {
+    if (!running.load()) return;
+
+    // Mix_HookMusic prend le verrou audio : au retour, le callback ne s'exécute plus
+    Mix_HookMusic(nullptr, nullptr);
+    running.store(false);
+    thread.join();
+    decoder.join();  // Attend la fin du morceau en cours de décodage
+
+    for (int track = 0; track < TRACK_COUNT; track++) {
+        Mix_Chunk* chunk = chunks[track].exchange(nullptr);
+        if (chunk) Mix_FreeChunk(chunk);
+        if (pending[track]) SDL_RWclose(pending[track]);
+        pending[track] = nullptr;
+        ready[track].store(false);
+    }
+}
+
+void MusicEngine::play(Track track) {
+    requested.store(track, std::memory_order_relaxed);
+}
+
+void MusicEngine::setVolume(int value) {
+    volume.store(std::min(MIX_MAX_VOLUME, std::max(0, value)), std::memory_order_relaxed);
+}
+
+void MusicEngine::mixLoop() {
+    Profiler::setThreadName("music mix");
+
+    while (running.load(std::memory_order_relaxed)) {
+        // Place libre : tout ce que le callback a consommé depuis le dernier remplissage
+        const size_t write = writePos.load(std::memory_order_relaxed);
+        const size_t used = write - readPos.load(std::memory_order_acquire);
+        const int frames = static_cast<int>((ringSamples - used) / channels);
+        if (frames > 0) {
+            mix(frames);
+            streaming.store(true, std::memory_order_relaxed);
+        }
+        SDL_Delay(FILL_PERIOD_MS);
+    }
+}
+
+void MusicEngine::decodeLoop() {
+    Profiler::setThreadName("music decode");
+
+    while (running.load(std::memory_order_relaxed) && decodeNext()) {
+    }
+}
+
+bool MusicEngine::decodeNext() {
+    int track = requested.load(std::memory_order_relaxed);
+    if (track == TRACK_NONE || !pending[track]) {
+        track = TRACK_NONE;
+        for (int candidate = 0; candidate < TRACK_COUNT; candidate++) {
+            if (pending[candidate]) {
+                track = candidate;
+                break;
+            }
+        }
+    }
+    if (track == TRACK_NONE) return false;
+
+    // Décodage complet au format du périphérique (aucune conversion à la lecture)
+    PROFILE_SCOPE("decode music");
+    Mix_Chunk* chunk = Mix_LoadWAV_RW(pending[track], 1);
+    pending[track] = nullptr;
+    if (!chunk) {
+        std::cerr << "Failed to decode music track " << track << ": " << Mix_GetError() << std::endl;
+    }
+    chunks[track].store(chunk, std::memory_order_release);
+    ready[track].store(true, std::memory_order_release);
+    return true;
+}
+
+void MusicEngine::mix(int frames) {
+    PROFILE_SCOPE("mix music");
+
+    // Changement de morceau : l'ancien s'éteint pendant que le nouveau monte
+    // (un morceau pas encore décodé est attendu, pour ne pas perdre son fondu)
+    const int target = requested.load(std::memory_order_relaxed);
+    if (target != current && (target == TRACK_NONE || ready[target].load(std::memory_order_acquire))) {
+        previous = current;
+        previousPos = currentPos;
+        current = target;
+        currentPos = 0;
+        fadeFrames = fadeLength;
+    }
+
+    const int samples = frames * channels;
+    int* out = mixBuffer.data();
+    std::fill(out, out + samples, 0);
+
+    const int fading = std::min(frames, fadeFrames);
+    if (fading > 0) {
+        const int fadeStart = fadeLength - fadeFrames;
+        accumulate(previous, previousPos, fading, -1, fadeStart, out);
+        accumulate(current, currentPos, fading, 1, fadeStart, out);
+        fadeFrames -= fading;
+        if (fadeFrames == 0) previous = TRACK_NONE;
+    }
+    accumulate(current, currentPos, frames - fading, 0, 0, out + fading * channels);
+
+    // Volume, saturation et copie dans le tampon circulaire
+    const int gain = volume.load(std::memory_order_relaxed);
+    const size_t write = writePos.load(std::memory_order_relaxed);
+    for (int i = 0; i < samples; i++) {
+        const int value = (out[i] * gain) / MIX_MAX_VOLUME;
+        ring[(write + i) & (ringSamples - 1)] = static_cast<Sint16>(std::min(32767, std::max(-32768, value)));
+    }
+    writePos.store(write + samples, std::memory_order_release);
+}
+
+void MusicEngine::accumulate(int track, size_t& pos, int frames, int fade, int fadeStart, int* out) const {
+    if (track == TRACK_NONE || frames <= 0) return;
+    const Mix_Chunk* chunk = chunks[track].load(std::memory_order_acquire);
+    if (!chunk) return;
+
+    const Sint16* data = reinterpret_cast<const Sint16*>(chunk->abuf);
+    const size_t length = (chunk->alen / sizeof(Sint16)) / channels * channels;
+    if (length == 0) return;
+
+    // Gain sur 15 bits : un échantillon multiplié tient dans un int
+    for (int frame = 0; frame < frames; frame++) {
+        int gain = 1 << 15;
+        if (fade != 0) {
+            const int progress = static_cast<int>((static_cast<long long>(fadeStart + frame) << 15) / fadeLength);
+            gain = fade > 0 ? progress : (1 << 15) - progress;
+        }
+        for (int c = 0; c < channels; c++) {
+            out[frame * channels + c] += (data[pos + c] * gain) >> 15;
+        }
+        // Bouclage sans blanc : la fin du morceau enchaîne sur son début
+        pos += channels;
+        if (pos >= length) pos = 0;
+    }
+}
+
+void MusicEngine::hook(void* udata, Uint8* stream, int len) {
+    MusicEngine* engine = static_cast<MusicEngine*>(udata);
+    Sint16* output = reinterpret_cast<Sint16*>(stream);
+    const size_t wanted = static_cast<size_t>(len) / sizeof(Sint16);
+
+    const size_t read = engine->readPos.load(std::memory_order_relaxed);
+    const size_t available = engine->writePos.load(std::memory_order_acquire) - read;
+    const size_t count = std::min(wanted, available);
+
+    // Copie en deux morceaux au plus (retour au début du tampon)
+    const size_t offset = read & (engine->ringSamples - 1);
+    const size_t first = std::min(count, engine->ringSamples - offset);
+    std::memcpy(output, engine->ring.data() + offset, first * sizeof(Sint16));
+    std::memcpy(output + first, engine->ring.data(), (count - first) * sizeof(Sint16));
+    engine->readPos.store(read + count, std::memory_order_release);
+
+    if (count < wanted) {
+        std::memset(output + count, 0, (wanted - count) * sizeof(Sint16));
+        if (engine->streaming.load(std::memory_order_relaxed)) {
+            engine->underruns.fetch_add(1, std::memory_order_relaxed);
+            engine->missingSamples.fetch_add(wanted - count, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#include "../headers/obstaclepool.hpp"
+#include <algorithm>
+#include <cstring>
+
+/*
+Stockage SoA des obstacles
+Les boucles ne lisent que les tableaux dont elles ont besoin : la mise à jour ne
+touche que ys/prevYs/speeds, l'élimination que ys, la collision les positions et tailles.
+
+Phase large : chaque voie garde ses indices triés par y. Les murs d'une même
+voie avancent ensemble, l'ordre ne change donc qu'à l'ajout (insertion près du
+début, les murs apparaissent en haut) et à la suppression (fin de voie pour un
+mur sorti par le bas). L'échange de suppression renumérote le dernier obstacle :
+son rang dans sa voie est retrouvé par dichotomie et corrigé.
+*/
+
+ObstaclePool::ObstaclePool(size_t capacity) :
+    count(0),
+    lanes(capacity),
+    xs(capacity),
+    ys(capacity),
+    prevYs(capacity),
+    widths(capacity),
+    heights(capacity),
+    speeds(capacity),
+    laneCount(DefaultTrack::LANE_COUNT),
+    laneWidth(DefaultTrack::LANE_W),
+    laneIndices(capacity * DefaultTrack::LANE_COUNT),
+    maxHeight(0),
+    mixedSpeeds(false) {
+    std::fill(laneCounts, laneCounts + MAX_TRACK_LANES, 0);
+}
+
+void ObstaclePool::clear() {
+    count = 0;
+    std::fill(laneCounts, laneCounts + MAX_TRACK_LANES, 0);
+    maxHeight = 0;
+    mixedSpeeds = false;
+}
+
+void ObstaclePool::setTrack(const TrackConfig& track) {
+    laneCount = track.lanes;
+    laneWidth = track.laneWidth;
+    // Une rangée d'indices par voie de la piste (pas par voie possible)
+    laneIndices.assign(lanes.size() * laneCount, 0);
+    clear();
+}
+
+bool ObstaclePool::add(int lane, int x, float y, int width, int height, int speed) {
+    if (count == lanes.size() || lane < 0 || lane >= laneCount) return false;
+
+    // Insertion à son rang dans la voie
+    Uint32* indices = &laneIndices[lane * lanes.size()];
+    const size_t rank = lowerBound(lane, y);
+    std::memmove(indices + rank + 1, indices + rank, (laneCounts[lane] - rank) * sizeof(Uint32));
+    indices[rank] = static_cast<Uint32>(count);
+    laneCounts[lane]++;
+    maxHeight = std::max(maxHeight, height);
+    if (count > 0 && speed != speeds[0]) mixedSpeeds = true;
+
+    // Réinitialisation sur place de la première case libre
+    lanes[count] = lane;
+    xs[count] = x;
+    ys[count] = y;
+    prevYs[count] = y;
+    widths[count] = width;
+    heights[count] = height;
+    speeds[count] = speed;
+    count++;
+    return true;
+}
+
+void ObstaclePool::remove(size_t index) {
+    // Retrait de la voie (le plus souvent le dernier rang : mur sorti par le bas)
+    const int lane = lanes[index];
+    Uint32* indices = &laneIndices[lane * lanes.size()];
+    const size_t rank = findInLane(index);
+    std::memmove(indices + rank, indices + rank + 1, (laneCounts[lane] - rank - 1) * sizeof(Uint32));
+    laneCounts[lane]--;
+
+    // Le dernier obstacle prend la place libérée, sa case rejoint les cases libres
+    const size_t last = --count;
+    if (index != last) {
+        laneIndices[lanes[last] * lanes.size() + findInLane(last)] = static_cast<Uint32>(index);
+        lanes[index] = lanes[last];
+        xs[index] = xs[last];
+        ys[index] = ys[last];
+        prevYs[index] = prevYs[last];
+        widths[index] = widths[last];
+        heights[index] = heights[last];
+        speeds[index] = speeds[last];
+    }
+}
+
+/*
+Mouvement vertical de tous les obstacles
+La vitesse de défilement dépend de la vitesse du vélo (illusion d'accélération)
+*/
+void ObstaclePool::update(int veloSpeed) {
+    const int bonus = (veloSpeed / 2) * VELO_SPEED_SCALE;
+    float* y = ys.data();
+    float* prevY = prevYs.data();
+    const int* speed = speeds.data();
+
+    for (size_t i = 0; i < count; i++) {
+        prevY[i] = y[i];
+        y[i] += (speed[i] + bonus) * SIM_DT;
+    }
+
+    if (mixedSpeeds) sortLanes();
+}
+
+size_t ObstaclePool::cullOffScreen() {
+    size_t removed = 0;
+    // Parcours à rebours : l'élément échangé a déjà été examiné
+    for (size_t i = count; i-- > 0;) {
+        if (ys[i] > WINDOW_HEIGHT) {
+            remove(i);
+            removed++;
+        }
+    }
+    return removed;
+}
+
+bool ObstaclePool::collides(const SDL_Rect& box) const {
+    if (count == 0) return false;
+
+    // Voies recouvertes par le rectangle (deux pendant un changement de voie)
+    const int firstLane = std::max(0, box.x / laneWidth);
+    const int lastLane = std::min(laneCount - 1, (box.x + box.w - 1) / laneWidth);
+
+    // Bande en y : un obstacle plus haut que box.y - maxHeight ne peut pas l'atteindre
+    // (marge d'un pixel pour la troncature des positions négatives)
+    const float top = static_cast<float>(box.y - maxHeight - 1);
+    const float bottom = static_cast<float>(box.y + box.h);
+
+    for (int lane = firstLane; lane <= lastLane; lane++) {
+        const Uint32* indices = &laneIndices[lane * lanes.size()];
+        for (size_t rank = lowerBound(lane, top); rank < laneCounts[lane]; rank++) {
+            const size_t i = indices[rank];
+            if (ys[i] >= bottom) break;
+
+            const int ox = xs[i] + COLLISION_PADDING;
+            const int oy = static_cast<int>(ys[i]) + COLLISION_PADDING;
+            const int ow = widths[i] - 2 * COLLISION_PADDING;
+            const int oh = heights[i] - 2 * COLLISION_PADDING;
+            if (box.x < ox + ow && box.x + box.w > ox && box.y < oy + oh && box.y + box.h > oy) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool ObstaclePool::collidesLinear(const SDL_Rect& box) const {
+    for (size_t i = 0; i < count; i++) {
+        // Test AABB sur la boîte de collision réduite de l'obstacle
+        const int ox = xs[i] + COLLISION_PADDING;
+        const int oy = static_cast<int>(ys[i]) + COLLISION_PADDING;
+        const int ow = widths[i] - 2 * COLLISION_PADDING;
+        const int oh = heights[i] - 2 * COLLISION_PADDING;
+        if (box.x < ox + ow && box.x + box.w > ox && box.y < oy + oh && box.y + box.h > oy) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SDL_Rect ObstaclePool::getCollisionBox(size_t index) const {
+    SDL_Rect collisionBox = {
+        xs[index] + COLLISION_PADDING,
+        static_cast<int>(ys[index]) + COLLISION_PADDING,
+        widths[index] - 2 * COLLISION_PADDING,
+        heights[index] - 2 * COLLISION_PADDING
+    };
+    return collisionBox;
+}
+
+size_t ObstaclePool::lowerBound(int lane, float y) const {
+    const Uint32* indices = &laneIndices[lane * lanes.size()];
+    size_t low = 0;
+    size_t high = laneCounts[lane];
+    while (low < high) {
+        const size_t mid = (low + high) / 2;
+        if (ys[indices[mid]] < y) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+size_t ObstaclePool::findInLane(size_t index) const {
+    // Les obstacles de même y sont contigus : courte recherche linéaire après la dichotomie
+    const Uint32* indices = &laneIndices[lanes[index] * lanes.size()];
+    size_t rank = lowerBound(lanes[index], ys[index]);
+    while (indices[rank] != index) rank++;
+    return rank;
+}
+
+/*
+Tri par insertion de chaque voie : presque linéaire, l'ordre ne change que
+pour les obstacles qui se dépassent pendant le pas
+*/
+void ObstaclePool::sortLanes() {
+    for (int lane = 0; lane < laneCount; lane++) {
+        Uint32* indices = &laneIndices[lane * lanes.size()];
+        for (size_t rank = 1; rank < laneCounts[lane]; rank++) {
+            const Uint32 index = indices[rank];
+            size_t hole = rank;
+            while (hole > 0 && ys[indices[hole - 1]] > ys[index]) {
+                indices[hole] = indices[hole - 1];
+                hole--;
+            }
+            indices[hole] = index;
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include "../headers/occupancygrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+OccupancyGrid::OccupancyGrid(int lanes, int laneWidth, int spawnHeight) :
+    lanes(std::min(std::max(lanes, 1), MAX_LANES)),
+    laneWidth(std::max(laneWidth, 1)),
+    spawnRows((std::max(spawnHeight, 0) + ROW_HEIGHT - 1) / ROW_HEIGHT),
+    head(0),
+    offset(0.0f) {
+    allLanes = this->lanes == MAX_LANES ? ~0ULL : (1ULL << this->lanes) - 1;
+
+    // Rangées visibles (la dernière peut être partiellement affichée)
+    rowCount = spawnRows + (WINDOW_HEIGHT + ROW_HEIGHT - 1) / ROW_HEIGHT;
+
+    Uint32 capacity = 1;
+    while (capacity < static_cast<Uint32>(rowCount)) capacity <<= 1;
+    ringMask = capacity - 1;
+    rows.assign(capacity, 0);
+}
+
+void OccupancyGrid::clear() {
+    std::fill(rows.begin(), rows.end(), 0);
+    head = 0;
+    offset = 0.0f;
+}
+
+bool OccupancyGrid::place(int lane, float y) {
+    if (lane < 0 || lane >= lanes) return false;
+    return placeMask(1ULL << lane, y);
+}
+
+bool OccupancyGrid::placeMask(Uint64 mask, float y) {
+    const int row = rowAt(y);
+    if (row < 0) return false;
+    rows[(head + row) & ringMask] |= mask & allLanes;
+    return true;
+}
+
+/*
+Défilement : une rangée entière franchie fait reculer la tête d'une case,
+la rangée sortie par le bas devient (vidée) la nouvelle rangée du haut
+*/
+int OccupancyGrid::scroll(float dy) {
+    offset += dy;
+    int exited = 0;
+    while (offset >= ROW_HEIGHT) {
+        offset -= ROW_HEIGHT;
+
+        // Murs de la dernière rangée visible (un bit effacé par tour de boucle)
+        for (Uint64 last = rows[(head + rowCount - 1) & ringMask]; last != 0; last &= last - 1) {
+            exited++;
+        }
+        head = (head - 1) & ringMask;
+        rows[head] = 0;
+    }
+    return exited;
+}
+
+bool OccupancyGrid::collides(Uint64 laneMask, int top, int bottom) const {
+    if (bottom <= top) return false;
+
+    // Rangées recouvertes par la bande, bornées à la grille
+    const int first = std::max(0, static_cast<int>(std::floor((top - offset) / ROW_HEIGHT)) + spawnRows);
+    const int last = std::min(rowCount - 1, static_cast<int>(std::floor((bottom - 1 - offset) / ROW_HEIGHT)) + spawnRows);
+
+    Uint64 occupied = 0;
+    for (int row = first; row <= last; row++) {
+        occupied |= rows[(head + row) & ringMask];
+    }
+    return (occupied & laneMask) != 0;
+}
+
+Uint64 OccupancyGrid::getLaneMask(int x, int width) const {
+    if (width <= 0) return 0;
+    const int first = std::max(0, x / laneWidth);
+    const int last = std::min(lanes - 1, (x + width - 1) / laneWidth);
+    if (first > last) return 0;
+
+    // Bits [first, last] : décalage en deux temps pour éviter un décalage de 64
+    const Uint64 upTo = last == MAX_LANES - 1 ? ~0ULL : (1ULL << (last + 1)) - 1;
+    return upTo & ~((1ULL << first) - 1);
+}
+
+int OccupancyGrid::rowAt(float y) const {
+    const int row = static_cast<int>(std::floor((y - offset) / ROW_HEIGHT)) + spawnRows;
+    return row >= 0 && row < rowCount ? row : -1;
+}
@@ -0,0 +1,145 @@
+#include "../headers/perfoverlay.hpp"
+#include "../headers/GameConstants.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+/*
+Panneau de performances
+Tout est préalloué : l'historique et la copie de tri sont des tableaux fixes,
+le texte est formaté sur la pile et dessiné avec l'atlas de glyphes. Les
+centiles sont obtenus avec nth_element sur 240 valeurs, ce qui reste bien en
+dessous du dixième de milliseconde. Le coût du panneau est lui-même affiché.
+*/
+
+namespace {
+    // Position et taille du panneau
+    const int PANEL_X = 10;
+    const int PANEL_Y = 70;
+    const int PANEL_WIDTH = PerfOverlay::HISTORY + 20;
+    const int GRAPH_HEIGHT = 80;
+    const int TEXT_LINE = 22;
+    const int PANEL_HEIGHT = GRAPH_HEIGHT + 20 + 4 * TEXT_LINE;
+
+    // Échelle verticale du graphe : 50 ms occupent toute la hauteur
+    const float GRAPH_MAX_MS = 50.0f;
+
+    // Budget d'une image à la fréquence visée
+    const float BUDGET_MS = 1000.0f / FPS;
+
+    const SDL_Color PANEL_COLOR = {0, 0, 0, 170};
+    const SDL_Color BUDGET_COLOR = {255, 255, 255, 120};
+    const SDL_Color GOOD_COLOR = {80, 220, 80, 255};
+    const SDL_Color SLOW_COLOR = {240, 200, 40, 255};
+    const SDL_Color STUTTER_COLOR = {240, 60, 60, 255};
+    const SDL_Color TEXT_COLOR = {255, 255, 255, 255};
+    const SDL_Color FROZEN_COLOR = {255, 120, 120, 255};
+}
+
+PerfOverlay::PerfOverlay() :
+    visible(false),
+    frozen(false),
+    head(0),
+    count(0),
+    overlayMs(0.0),
+    frequency(SDL_GetPerformanceFrequency() / 1000.0) {
+    std::fill(frameTimes, frameTimes + HISTORY, 0.0f);
+}
+
+void PerfOverlay::addFrame(double ms) {
+    if (frozen) return;
+    frameTimes[head] = static_cast<float>(ms);
+    head = (head + 1) % HISTORY;
+    if (count < HISTORY) count++;
+}
+
+void PerfOverlay::toggleCapture(const char* path) {
+    frozen = !frozen;
+    if (frozen) {
+        if (writeCapture(path)) {
+            std::cout << "Frame times captured to " << path << std::endl;
+        } else {
+            std::cerr << "Échec de l'écriture de la capture " << path << std::endl;
+        }
+    }
+}
+
+bool PerfOverlay::writeCapture(const char* path) const {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+
+    fputs("frame,ms\n", file);
+    for (int i = 0; i < count; i++) {
+        int index = (head - count + i + HISTORY) % HISTORY;
+        fprintf(file, "%d,%.3f\n", i, frameTimes[index]);
+    }
+    fclose(file);
+    return true;
+}
+
+void PerfOverlay::render(SpriteBatch& batch, GlyphAtlas& atlas, const Counters& counters) {
+    if (!visible) return;
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    // Fond du panneau et ligne du budget d'une image
+    SDL_Rect panel = {PANEL_X, PANEL_Y, PANEL_WIDTH, PANEL_HEIGHT};
+    batch.fillRect(panel, PANEL_COLOR, LAYER_DEBUG);
+
+    const float graphLeft = static_cast<float>(PANEL_X + 10);
+    const float graphBottom = static_cast<float>(PANEL_Y + 10 + GRAPH_HEIGHT);
+    const float scale = GRAPH_HEIGHT / GRAPH_MAX_MS;
+    SDL_Rect budgetLine = {PANEL_X + 10, static_cast<int>(graphBottom - BUDGET_MS * scale), HISTORY, 1};
+
+    // Une barre d'un pixel par image, de la plus ancienne à la plus récente
+    for (int i = 0; i < count; i++) {
+        float ms = frameTimes[(head - count + i + HISTORY) % HISTORY];
+        float height = std::min(ms, GRAPH_MAX_MS) * scale;
+        SDL_Color color = ms <= BUDGET_MS * 1.1f ? GOOD_COLOR
+                        : ms <= BUDGET_MS * 2.0f ? SLOW_COLOR : STUTTER_COLOR;
+        float x = graphLeft + (HISTORY - count + i);
+        batch.addQuad(nullptr, LAYER_DEBUG, x, graphBottom - height, x + 1.0f, graphBottom,
+                      0.0f, 0.0f, 0.0f, 0.0f, color);
+    }
+    batch.fillRect(budgetLine, BUDGET_COLOR, LAYER_DEBUG);
+
+    // Centiles sur une copie de l'historique
+    float p50 = 0.0f, p99 = 0.0f, maxMs = 0.0f;
+    if (count > 0) {
+        std::copy(frameTimes, frameTimes + count, sorted);
+        float* end = sorted + count;
+        float* median = sorted + count / 2;
+        float* high = sorted + (count * 99) / 100;
+        std::nth_element(sorted, high, end);
+        p99 = *high;
+        maxMs = *std::max_element(high, end);
+        std::nth_element(sorted, median, high);
+        p50 = *median;
+    }
+
+    if (atlas.isReady()) {
+        char line[96];
+        int textX = PANEL_X + 10;
+        int textY = PANEL_Y + 20 + GRAPH_HEIGHT;
+
+        SDL_snprintf(line, sizeof(line), "p50 %.2f  p99 %.2f  max %.2f ms", p50, p99, maxMs);
+        atlas.drawText(batch, line, textX, textY, TEXT_COLOR, LAYER_DEBUG_TEXT);
+
+        SDL_snprintf(line, sizeof(line), "Appels de rendu: %d  Obstacles: %u",
+                     counters.drawCalls, static_cast<unsigned>(counters.obstacles));
+        atlas.drawText(batch, line, textX, textY + TEXT_LINE, TEXT_COLOR, LAYER_DEBUG_TEXT);
+
+        SDL_snprintf(line, sizeof(line), "Textures: %.1f Mo",
+                     counters.textureBytes / (1024.0 * 1024.0));
+        atlas.drawText(batch, line, textX, textY + 2 * TEXT_LINE, TEXT_COLOR, LAYER_DEBUG_TEXT);
+
+        if (frozen) {
+            atlas.drawText(batch, "FIGÉ (F4 pour reprendre)", textX, textY + 3 * TEXT_LINE,
+                           FROZEN_COLOR, LAYER_DEBUG_TEXT);
+        } else {
+            SDL_snprintf(line, sizeof(line), "Panneau: %.3f ms", overlayMs);
+            atlas.drawText(batch, line, textX, textY + 3 * TEXT_LINE, TEXT_COLOR, LAYER_DEBUG_TEXT);
+        }
+    }
+
+    overlayMs = (SDL_GetPerformanceCounter() - start) / frequency;
+}
@@ -0,0 +1,119 @@
+#include "../headers/profiler.hpp"
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+Tampons de profilage
+Chaque thread possède son tampon circulaire : l'écriture d'un événement est une
+copie suivie d'un incrément atomique de la tête. Le registre des tampons n'est
+verrouillé qu'à la première zone mesurée d'un thread et lors de l'export.
+L'export lit les tampons pendant que les threads continuent d'écrire : un
+événement en cours d'écrasement peut être incohérent, ce qui est acceptable
+pour un outil de diagnostic.
+*/
+
+namespace {
+    struct ProfileEvent {
+        const char* name;
+        Uint64 start;
+        Uint64 end;
+    };
+
+    struct ThreadBuffer {
+        int threadId;
+        const char* threadName;
+        std::atomic<Uint64> head;  // Nombre total d'événements écrits
+        ProfileEvent events[Profiler::BUFFER_CAPACITY];
+
+        explicit ThreadBuffer(int id) : threadId(id), threadName(nullptr), head(0) {}
+    };
+
+    std::atomic<bool> profilerEnabled(false);
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> registry;
+
+    thread_local ThreadBuffer* localBuffer = nullptr;
+
+    ThreadBuffer* currentBuffer() {
+        if (!localBuffer) {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            registry.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer(static_cast<int>(registry.size()) + 1)));
+            localBuffer = registry.back().get();
+        }
+        return localBuffer;
+    }
+
+    // Échappe les caractères spéciaux JSON d'un nom de zone
+    void writeJsonString(FILE* file, const char* text) {
+        fputc('"', file);
+        for (const char* c = text; *c; c++) {
+            if (*c == '"' || *c == '\\') fputc('\\', file);
+            fputc(*c, file);
+        }
+        fputc('"', file);
+    }
+}
+
+void Profiler::setEnabled(bool enabled) {
+    profilerEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled() {
+    return profilerEnabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::setThreadName(const char* name) {
+    // Aucun tampon n'est créé tant que le profilage est désactivé
+    if (!isEnabled()) return;
+    currentBuffer()->threadName = name;
+}
+
+void Profiler::record(const char* name, Uint64 start, Uint64 end) {
+    ThreadBuffer* buffer = currentBuffer();
+    Uint64 head = buffer->head.load(std::memory_order_relaxed);
+    ProfileEvent& event = buffer->events[head % BUFFER_CAPACITY];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+bool Profiler::dumpChromeTrace(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+
+    const double toMicros = 1000000.0 / SDL_GetPerformanceFrequency();
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+
+    for (const auto& buffer : registry) {
+        // Nom du thread (événement de métadonnées)
+        if (buffer->threadName) {
+            fprintf(file, "%s{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":",
+                    first ? "" : ",\n", buffer->threadId);
+            writeJsonString(file, buffer->threadName);
+            fputs("}}", file);
+            first = false;
+        }
+
+        // Événements encore présents dans le tampon circulaire
+        Uint64 head = buffer->head.load(std::memory_order_acquire);
+        Uint64 begin = head > BUFFER_CAPACITY ? head - BUFFER_CAPACITY : 0;
+        for (Uint64 i = begin; i < head; i++) {
+            const ProfileEvent& event = buffer->events[i % BUFFER_CAPACITY];
+            fprintf(file, "%s{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"name\":", first ? "" : ",\n", buffer->threadId);
+            writeJsonString(file, event.name);
+            fprintf(file, ",\"ts\":%.3f,\"dur\":%.3f}", event.start * toMicros, (event.end - event.start) * toMicros);
+            first = false;
+        }
+    }
+
+    fputs("\n]}\n", file);
+    fclose(file);
+    return true;
+}
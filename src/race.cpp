@@ -0,0 +1,161 @@
+#include "../headers/race.hpp"
+#include "../headers/profiler.hpp"
+
+namespace {
+    // Hauteur des murs d'une vague : WAVE_TOP, moins un tirage dans [0, WAVE_JITTER),
+    // moins WAVE_LANE_STEP par voie (les murs arrivent en escalier)
+    const int WAVE_TOP = -70;
+    const int WAVE_JITTER = 100;
+    const int WAVE_LANE_STEP = 100;
+}
+
+/*
+Règles d'un pas de simulation
+L'ordre des étapes de tick() est celui que suivait Game::update : une même
+graine et une même suite d'actions donnent la même partie dans le jeu, ses
+rejeux et VecEnv.
+*/
+
+Race::Race(size_t capacity) :
+    track(&DefaultTrack::CONFIG),
+    clock(nullptr),
+    clockData(nullptr),
+    walls(capacity),
+    grid(DefaultTrack::LANE_COUNT, DefaultTrack::LANE_W, 0),
+    lane(DefaultTrack::LANE_COUNT / 2),
+    x(0.0f),
+    prevX(0.0f),
+    targetX(0),
+    speed(BIKE_START_SPEED),
+    lastSpawnTime(0),
+    culled(0) {
+    targetX = track->bikeX->x[lane];
+    x = prevX = static_cast<float>(targetX);
+}
+
+void Race::setTrack(const TrackConfig& track) {
+    this->track = &track;
+    if (usesGrid()) {
+        // Rangées au-dessus de l'écran : jusqu'au mur le plus haut d'une vague
+        const int spawnHeight = -WAVE_TOP + WAVE_JITTER + (track.lanes - 1) * WAVE_LANE_STEP + OccupancyGrid::ROW_HEIGHT;
+        grid = OccupancyGrid(track.lanes, track.laneWidth, spawnHeight);
+    } else {
+        walls.setTrack(track);
+    }
+    lane = track.lanes / 2;
+    targetX = track.bikeX->x[lane];
+    x = prevX = static_cast<float>(targetX);
+}
+
+void Race::setClock(Timer::Clock clock, void* userdata) {
+    this->clock = clock;
+    clockData = userdata;
+    timer.setClock(clock, userdata);
+}
+
+Uint32 Race::now() const {
+    return clock ? clock(clockData) : SDL_GetTicks();
+}
+
+void Race::start() {
+    walls.clear();
+    grid.clear();
+    lane = track->lanes / 2;  // Départ dans la voie du milieu
+    speed = BIKE_START_SPEED;
+    targetX = track->bikeX->x[lane];
+    x = prevX = static_cast<float>(targetX);
+    culled = 0;
+
+    timer.start(GAME_TIME);
+    lastSpawnTime = now();
+}
+
+bool Race::applyAction(InputAction action) {
+    switch (action) {
+        case ACTION_MOVE_LEFT:
+            if (lane <= 0) return false;
+            targetX = track->bikeX->x[--lane];
+            return true;
+        case ACTION_MOVE_RIGHT:
+            if (lane >= track->lanes - 1) return false;
+            targetX = track->bikeX->x[++lane];
+            return true;
+        case ACTION_SPEED_UP:
+            if (speed >= BIKE_MAX_SPEED) return false;
+            speed++;
+            return true;
+        case ACTION_SPEED_DOWN:
+            if (speed <= BIKE_MIN_SPEED) return false;
+            speed--;
+            return true;
+        default:
+            return false;
+    }
+}
+
+Race::Outcome Race::tick(Pcg32& rng, bool spawning) {
+    // Glissement du vélo vers sa voie, sans dépasser la cible
+    prevX = x;
+    const float step = BIKE_MOVE_SPEED * SIM_DT;
+    if (x < targetX) {
+        x += step;
+        if (x > targetX) x = static_cast<float>(targetX);
+    } else if (x > targetX) {
+        x -= step;
+        if (x < targetX) x = static_cast<float>(targetX);
+    }
+
+    // Murs : avance, élimination hors écran, puis vague si le délai est écoulé
+    if (usesGrid()) {
+        culled = grid.scroll((WALL_SPEED + (speed / 2) * VELO_SPEED_SCALE) * SIM_DT);
+    } else {
+        walls.update(speed);
+        culled = walls.cullOffScreen();
+    }
+
+    const Uint32 currentTime = now();
+    if (spawning && currentTime - lastSpawnTime > static_cast<Uint32>(OBSTACLE_INTERVAL_MS)) {
+        spawnWave(rng);
+        lastSpawnTime = currentTime;
+    }
+
+    // Collision avec les murs proches du vélo (phase large par voie, ou
+    // rangées de la grille recouvertes par le vélo)
+    const SDL_Rect box = getBikeCollisionBox();
+    const bool hit = usesGrid() ? grid.collides(grid.getLaneMask(box.x, box.w), box.y, box.y + box.h)
+                                : walls.collides(box);
+    if (hit) return CRASHED;
+    return timer.getRemainingTime() <= 0 ? TIME_UP : RUNNING;
+}
+
+void Race::spawnSingleWall(Pcg32& rng) {
+    spawnWall(static_cast<int>(rng.nextBelow(track->lanes)), WAVE_TOP);
+}
+
+void Race::spawnWave(Pcg32& rng) {
+    PROFILE_SCOPE("spawnWave");
+    for (int wallLane = 0; wallLane < track->lanes; ++wallLane) {
+        int verticalOffset = WAVE_TOP - static_cast<int>(rng.nextBelow(WAVE_JITTER)) - (wallLane * WAVE_LANE_STEP);
+        spawnWall(wallLane, verticalOffset);
+    }
+}
+
+SDL_Rect Race::getBikeCollisionBox() const {
+    SDL_Rect collisionBox = {
+        static_cast<int>(x) + BIKE_COLLISION_PADDING,
+        BIKE_Y + BIKE_COLLISION_PADDING,
+        BIKE_WIDTH - 2 * BIKE_COLLISION_PADDING,
+        BIKE_HEIGHT - 2 * BIKE_COLLISION_PADDING
+    };
+    return collisionBox;
+}
+
+/* Aucune allocation : seules les positions sont écrites, dans la première case
+   libre du stockage ou dans la rangée de la grille */
+void Race::spawnWall(int wallLane, int startY) {
+    if (usesGrid()) {
+        grid.place(wallLane, static_cast<float>(startY));
+        return;
+    }
+    walls.add(wallLane, track->wallX->x[wallLane], static_cast<float>(startY), track->wallWidth, WALL_HEIGHT, WALL_SPEED);
+}
@@ -0,0 +1,43 @@
+#include "../headers/random.hpp"
+
+/*
+PCG32 (M.E. O'Neill, pcg-random.org)
+Générateur congruentiel 64 bits dont la sortie est permutée (décalage xor puis
+rotation dépendant des bits de poids fort). nextBelow utilise la réduction par
+multiplication de Lemire : une multiplication 64 bits par tirage, et un rejet
+rare uniquement pour éliminer le biais.
+*/
+
+Pcg32::Pcg32(Uint64 seed, Uint64 stream) {
+    this->seed(seed, stream);
+}
+
+void Pcg32::seed(Uint64 seed, Uint64 stream) {
+    state = 0;
+    increment = (stream << 1) | 1;
+    next();
+    state += seed;
+    next();
+}
+
+Uint32 Pcg32::next() {
+    Uint64 old = state;
+    state = old * 6364136223846793005ULL + increment;
+    Uint32 xorshifted = static_cast<Uint32>(((old >> 18) ^ old) >> 27);
+    Uint32 rotation = static_cast<Uint32>(old >> 59);
+    return (xorshifted >> rotation) | (xorshifted << ((32 - rotation) & 31));
+}
+
+Uint32 Pcg32::nextBelow(Uint32 bound) {
+    Uint64 product = static_cast<Uint64>(next()) * bound;
+    Uint32 low = static_cast<Uint32>(product);
+    if (low < bound) {
+        // Seuil de rejet : 2^32 mod bound
+        Uint32 threshold = static_cast<Uint32>(-bound) % bound;
+        while (low < threshold) {
+            product = static_cast<Uint64>(next()) * bound;
+            low = static_cast<Uint32>(product);
+        }
+    }
+    return static_cast<Uint32>(product >> 32);
+}
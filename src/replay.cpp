@@ -0,0 +1,146 @@
+#include "../headers/replay.hpp"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    const char REPLAY_MAGIC[8] = {'V', 'E', 'L', 'O', 'R', 'E', 'P', '1'};
+    const size_t HEADER_SIZE = sizeof(REPLAY_MAGIC) + 8 + 4;
+
+    void writeUint(std::vector<Uint8>& data, Uint64 value, int bytes) {
+        for (int i = 0; i < bytes; i++) {
+            data.push_back(static_cast<Uint8>(value >> (8 * i)));
+        }
+    }
+
+    Uint64 readUint(const Uint8* data, int bytes) {
+        Uint64 value = 0;
+        for (int i = 0; i < bytes; i++) {
+            value |= static_cast<Uint64>(data[i]) << (8 * i);
+        }
+        return value;
+    }
+}
+
+Uint64 fnv1a(Uint64 hash, const void* data, size_t size) {
+    const Uint8* bytes = static_cast<const Uint8*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+ReplayRecorder::ReplayRecorder() :
+    recording(false),
+    lastTick(0) {}
+
+void ReplayRecorder::begin(const std::string& path, Uint64 seed, Uint32 flags) {
+    this->path = path;
+    data.clear();
+    data.reserve(64 * 1024);  // Plusieurs minutes d'actions sans réallocation
+    data.insert(data.end(), REPLAY_MAGIC, REPLAY_MAGIC + sizeof(REPLAY_MAGIC));
+    writeUint(data, seed, 8);
+    writeUint(data, flags, 4);
+    lastTick = 0;
+    recording = true;
+}
+
+void ReplayRecorder::writeVarint(Uint32 value) {
+    while (value >= 0x80) {
+        data.push_back(static_cast<Uint8>(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back(static_cast<Uint8>(value));
+}
+
+void ReplayRecorder::record(Uint32 tick, InputAction action) {
+    if (!recording) return;
+    writeVarint(tick - lastTick);
+    data.push_back(static_cast<Uint8>(action));
+    lastTick = tick;
+}
+
+bool ReplayRecorder::finish(Uint32 tick, Uint64 stateHash) {
+    if (!recording) return false;
+    recording = false;
+
+    writeVarint(tick - lastTick);
+    data.push_back(REPLAY_END_MARKER);
+    writeUint(data, stateHash, 8);
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Impossible d'écrire le rejeu " << path << std::endl;
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return ok;
+}
+
+ReplayPlayer::ReplayPlayer() :
+    seed(0),
+    flags(0),
+    finalTick(0),
+    expectedHash(0),
+    cursor(0) {}
+
+bool ReplayPlayer::load(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        std::cerr << "Impossible d'ouvrir le rejeu " << path << std::endl;
+        return false;
+    }
+    std::vector<Uint8> data;
+    Uint8 buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(file);
+
+    if (data.size() < HEADER_SIZE || std::memcmp(data.data(), REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0) {
+        std::cerr << "Fichier de rejeu invalide: " << path << std::endl;
+        return false;
+    }
+    seed = readUint(&data[8], 8);
+    flags = static_cast<Uint32>(readUint(&data[16], 4));
+
+    // Décodage des actions jusqu'au marqueur de fin
+    actions.clear();
+    cursor = 0;
+    Uint32 tick = 0;
+    size_t position = HEADER_SIZE;
+    while (position < data.size()) {
+        Uint32 delta = 0;
+        int shift = 0;
+        while (position < data.size() && shift < 35) {
+            Uint8 byte = data[position++];
+            delta |= static_cast<Uint32>(byte & 0x7F) << shift;
+            shift += 7;
+            if (!(byte & 0x80)) break;
+        }
+        if (position >= data.size()) break;
+
+        tick += delta;
+        Uint8 action = data[position++];
+        if (action == REPLAY_END_MARKER) {
+            if (data.size() - position < 8) break;
+            finalTick = tick;
+            expectedHash = readUint(&data[position], 8);
+            return true;
+        }
+        if (action >= ACTION_COUNT) break;
+        actions.push_back({tick, action});
+    }
+
+    std::cerr << "Fichier de rejeu tronqué: " << path << std::endl;
+    return false;
+}
+
+bool ReplayPlayer::nextAction(Uint32 tick, InputAction& action) {
+    if (cursor >= actions.size() || actions[cursor].tick != tick) return false;
+    action = static_cast<InputAction>(actions[cursor++].action);
+    return true;
+}
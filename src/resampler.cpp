@@ -0,0 +1,191 @@
+#include "../headers/resampler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+Filtre par zone séparable
+Les poids de chaque axe sont calculés une fois : pour un pixel de destination,
+l'intervalle source couvert est [centre - r, centre + r] avec r la demi-largeur
+d'un pixel de destination (au moins un demi pixel source, ce qui donne une
+interpolation linéaire en agrandissement). La passe horizontale écrit une
+image intermédiaire en flottants prémultipliés, la passe verticale la réduit
+et repasse en octets.
+*/
+
+namespace {
+    std::atomic<Uint64> resampledImages(0);
+    std::atomic<Uint64> resampledBytesBefore(0);
+    std::atomic<Uint64> resampledBytesAfter(0);
+
+    /* Pixels source contribuant à un pixel de destination */
+    struct Span {
+        int first;         // Premier pixel source
+        int count;         // Nombre de pixels source
+        int weightOffset;  // Position du premier poids
+    };
+
+    void buildSpans(int srcSize, int dstSize, std::vector<Span>& spans, std::vector<float>& weights) {
+        const double scale = static_cast<double>(srcSize) / dstSize;
+        const double radius = std::max(scale, 1.0) * 0.5;
+        spans.resize(dstSize);
+        weights.clear();
+
+        for (int i = 0; i < dstSize; i++) {
+            double center = (i + 0.5) * scale;
+            double low = std::max(center - radius, 0.0);
+            double high = std::min(center + radius, static_cast<double>(srcSize));
+            int first = static_cast<int>(std::floor(low));
+            int last = std::min(static_cast<int>(std::ceil(high)), srcSize) - 1;
+            if (last < first) last = first;
+
+            spans[i].first = first;
+            spans[i].count = last - first + 1;
+            spans[i].weightOffset = static_cast<int>(weights.size());
+
+            // Poids = recouvrement de chaque pixel source, normalisé
+            double total = 0.0;
+            for (int j = first; j <= last; j++) {
+                double overlap = std::min(high, j + 1.0) - std::max(low, static_cast<double>(j));
+                total += std::max(overlap, 0.0);
+            }
+            for (int j = first; j <= last; j++) {
+                double overlap = std::max(std::min(high, j + 1.0) - std::max(low, static_cast<double>(j)), 0.0);
+                weights.push_back(static_cast<float>(total > 0.0 ? overlap / total : 1.0 / spans[i].count));
+            }
+        }
+    }
+
+#ifdef __SSE2__
+    /* Pixel RGBA8 -> quatre flottants prémultipliés */
+    inline __m128 loadPremultiplied(const Uint8* pixel) {
+        Uint32 packed;
+        std::memcpy(&packed, pixel, 4);
+        __m128i bytes = _mm_cvtsi32_si128(static_cast<int>(packed));
+        __m128i zero = _mm_setzero_si128();
+        __m128 color = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero));
+        __m128 alpha = _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3));
+        // (a/255, a/255, a/255, 1) : l'alpha lui-même n'est pas multiplié
+        __m128 factor = _mm_mul_ps(alpha, _mm_set_ps(0.0f, 1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f));
+        factor = _mm_add_ps(factor, _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+        return _mm_mul_ps(color, factor);
+    }
+
+    /* Quatre flottants prémultipliés -> pixel RGBA8 */
+    inline void storeUnpremultiplied(__m128 color, Uint8* pixel) {
+        __m128 alpha = _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128 inverse = _mm_div_ps(_mm_set1_ps(255.0f), _mm_max_ps(alpha, _mm_set1_ps(1e-3f)));
+        __m128 factor = _mm_add_ps(_mm_mul_ps(inverse, _mm_set_ps(0.0f, 1.0f, 1.0f, 1.0f)),
+                                   _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+        color = _mm_min_ps(_mm_max_ps(_mm_mul_ps(color, factor), _mm_setzero_ps()), _mm_set1_ps(255.0f));
+        __m128i ints = _mm_cvtps_epi32(color);
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(ints, ints), _mm_setzero_si128());
+        Uint32 packed = static_cast<Uint32>(_mm_cvtsi128_si32(bytes));
+        std::memcpy(pixel, &packed, 4);
+    }
+#endif
+
+    /* Passe horizontale : ligne RGBA8 -> ligne de flottants prémultipliés */
+    void resampleRow(const Uint8* src, float* dst, const std::vector<Span>& spans, const std::vector<float>& weights) {
+        for (size_t x = 0; x < spans.size(); x++) {
+            const Span& span = spans[x];
+            const float* w = &weights[span.weightOffset];
+            const Uint8* pixel = src + span.first * 4;
+#ifdef __SSE2__
+            __m128 sum = _mm_setzero_ps();
+            for (int k = 0; k < span.count; k++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(loadPremultiplied(pixel + k * 4), _mm_set1_ps(w[k])));
+            }
+            _mm_storeu_ps(dst + x * 4, sum);
+#else
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (int k = 0; k < span.count; k++) {
+                const Uint8* p = pixel + k * 4;
+                float a = p[3] * w[k];
+                sum[0] += p[0] * a / 255.0f;
+                sum[1] += p[1] * a / 255.0f;
+                sum[2] += p[2] * a / 255.0f;
+                sum[3] += a;
+            }
+            std::copy(sum, sum + 4, dst + x * 4);
+#endif
+        }
+    }
+
+    /* Passe verticale : colonne de lignes intermédiaires -> ligne RGBA8 */
+    void resampleColumn(const std::vector<float>& rows, int rowFloats, const Span& span, const float* w,
+                        int width, Uint8* dst) {
+        for (int x = 0; x < width; x++) {
+            const float* pixel = &rows[static_cast<size_t>(span.first) * rowFloats + x * 4];
+#ifdef __SSE2__
+            __m128 sum = _mm_setzero_ps();
+            for (int k = 0; k < span.count; k++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(pixel + k * rowFloats), _mm_set1_ps(w[k])));
+            }
+            storeUnpremultiplied(sum, dst + x * 4);
+#else
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (int k = 0; k < span.count; k++) {
+                for (int c = 0; c < 4; c++) sum[c] += pixel[k * rowFloats + c] * w[k];
+            }
+            float inverse = sum[3] > 1e-3f ? 255.0f / sum[3] : 0.0f;
+            for (int c = 0; c < 3; c++) {
+                dst[x * 4 + c] = static_cast<Uint8>(std::min(std::max(sum[c] * inverse, 0.0f), 255.0f) + 0.5f);
+            }
+            dst[x * 4 + 3] = static_cast<Uint8>(std::min(std::max(sum[3], 0.0f), 255.0f) + 0.5f);
+#endif
+        }
+    }
+}
+
+SDL_Surface* resampleSurface(SDL_Surface* source, int width, int height) {
+    if (!source || width <= 0 || height <= 0) return nullptr;
+
+    // Travail en RGBA 8 bits, quel que soit le format d'origine
+    SDL_Surface* rgba = source->format->format == SDL_PIXELFORMAT_RGBA32
+                      ? source : SDL_ConvertSurfaceFormat(source, SDL_PIXELFORMAT_RGBA32, 0);
+    if (!rgba) return nullptr;
+
+    SDL_Surface* result = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (result) {
+        std::vector<Span> spansX, spansY;
+        std::vector<float> weightsX, weightsY;
+        buildSpans(rgba->w, width, spansX, weightsX);
+        buildSpans(rgba->h, height, spansY, weightsY);
+
+        // Passe horizontale sur toutes les lignes source
+        const int rowFloats = width * 4;
+        std::vector<float> rows(static_cast<size_t>(rowFloats) * rgba->h);
+        SDL_LockSurface(rgba);
+        for (int y = 0; y < rgba->h; y++) {
+            const Uint8* src = static_cast<const Uint8*>(rgba->pixels) + y * rgba->pitch;
+            resampleRow(src, &rows[static_cast<size_t>(y) * rowFloats], spansX, weightsX);
+        }
+        SDL_UnlockSurface(rgba);
+
+        // Passe verticale
+        for (int y = 0; y < height; y++) {
+            Uint8* dst = static_cast<Uint8*>(result->pixels) + y * result->pitch;
+            resampleColumn(rows, rowFloats, spansY[y], &weightsY[spansY[y].weightOffset], width, dst);
+        }
+
+        resampledImages++;
+        resampledBytesBefore += static_cast<Uint64>(source->w) * source->h * 4;
+        resampledBytesAfter += static_cast<Uint64>(width) * height * 4;
+    }
+
+    if (rgba != source) SDL_FreeSurface(rgba);
+    return result;
+}
+
+void getResampleStats(Uint64* images, Uint64* bytesBefore, Uint64* bytesAfter) {
+    if (images) *images = resampledImages.load();
+    if (bytesBefore) *bytesBefore = resampledBytesBefore.load();
+    if (bytesAfter) *bytesAfter = resampledBytesAfter.load();
+}
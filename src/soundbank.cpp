@@ -0,0 +1,178 @@
+#include "../headers/soundbank.hpp"
+#include "../headers/profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    const double TWO_PI = 6.283185307179586;
+
+    /* Description d'un effet synthétisé : balayage de fréquence et bruit,
+       sous une enveloppe à attaque linéaire et décroissance exponentielle */
+    struct SynthParams {
+        int durationMs;
+        double startHz;     // Fréquence de la sinusoïde au début (0 : pas de sinusoïde)
+        double endHz;       // Fréquence à la fin du balayage
+        double noise;       // Part de bruit blanc (0 à 1)
+        int attackMs;
+        double decay;       // Constante de décroissance (en durées d'effet)
+        int volume;         // Volume du chunk (0 à MIX_MAX_VOLUME)
+    };
+
+    const SynthParams SYNTH_PARAMS[SoundBank::SOUND_COUNT] = {
+        {300, 90.0, 40.0, 0.7, 2, 0.25, MIX_MAX_VOLUME},        // Collision : choc sourd et bruit
+        {900, 440.0, 110.0, 0.0, 10, 0.6, MIX_MAX_VOLUME},      // Fin de partie (secours)
+        {90, 0.0, 0.0, 1.0, 30, 0.5, MIX_MAX_VOLUME / 3},       // Changement de voie : souffle
+        {100, 500.0, 900.0, 0.0, 5, 0.7, MIX_MAX_VOLUME / 3},   // Accélération : balayage montant
+        {100, 700.0, 400.0, 0.0, 5, 0.7, MIX_MAX_VOLUME / 3}    // Ralentissement : balayage descendant
+    };
+}
+
+SoundBank::SoundBank() :
+    loaded(false),
+    channels(2),
+    frequency(MIX_DEFAULT_FREQUENCY),
+    latencyCount(0),
+    latencySumMicros(0),
+    latencyMaxMicros(0)
+{
+    for (int sound = 0; sound < SOUND_COUNT; sound++) chunks[sound] = nullptr;
+    for (int channel = 0; channel < CHANNELS; channel++) pendingTrigger[channel].store(0);
+}
+
+SoundBank::~SoundBank() {
+    unload();
+}
+
+bool SoundBank::load(SDL_RWops* gameOver) {
+    PROFILE_SCOPE("SoundBank::load");
+    unload();
+
+    Uint16 format = 0;
+    if (!Mix_QuerySpec(&frequency, &format, &channels) || format != AUDIO_S16SYS) {
+        std::cerr << "Sound bank: unsupported audio format" << std::endl;
+        if (gameOver) SDL_RWclose(gameOver);
+        return false;
+    }
+    Mix_AllocateChannels(CHANNELS);
+
+    // Décodage complet au format du périphérique
+    if (gameOver) {
+        chunks[SOUND_GAME_OVER] = Mix_LoadWAV_RW(gameOver, 1);
+        if (!chunks[SOUND_GAME_OVER]) {
+            std::cerr << "Failed to decode game over sound: " << Mix_GetError() << std::endl;
+        }
+    }
+
+    for (int sound = 0; sound < SOUND_COUNT; sound++) {
+        if (!chunks[sound]) synthesize(static_cast<Sound>(sound));
+    }
+
+    latencyCount.store(0);
+    latencySumMicros.store(0);
+    latencyMaxMicros.store(0);
+    Mix_SetPostMix(&SoundBank::postMix, this);
+    loaded = true;
+    return true;
+}
+
+void SoundBank::unload() {
+    if (!loaded) return;
+
+    // Mix_SetPostMix prend le verrou audio : au retour, le callback ne s'exécute plus
+    Mix_SetPostMix(nullptr, nullptr);
+    Mix_HaltChannel(-1);
+    for (int sound = 0; sound < SOUND_COUNT; sound++) {
+        if (chunks[sound]) Mix_FreeChunk(chunks[sound]);
+        chunks[sound] = nullptr;
+        synthesized[sound].clear();
+        synthesized[sound].shrink_to_fit();
+    }
+    loaded = false;
+}
+
+void SoundBank::synthesize(Sound sound) {
+    const SynthParams& params = SYNTH_PARAMS[sound];
+    const int frames = params.durationMs * frequency / 1000;
+    const int attack = std::max(1, params.attackMs * frequency / 1000);
+    std::vector<Sint16>& samples = synthesized[sound];
+    samples.assign(static_cast<size_t>(frames) * channels, 0);
+
+    // Bruit reproductible (indépendant du générateur de la partie)
+    Uint32 noiseState = 0x9E3779B9u + static_cast<Uint32>(sound);
+    double phase = 0.0;
+    for (int frame = 0; frame < frames; frame++) {
+        const double t = static_cast<double>(frame) / frames;
+        const double hz = params.startHz + (params.endHz - params.startHz) * t;
+        phase += TWO_PI * hz / frequency;
+
+        noiseState ^= noiseState << 13;
+        noiseState ^= noiseState >> 17;
+        noiseState ^= noiseState << 5;
+        const double white = static_cast<double>(noiseState) / 2147483648.0 - 1.0;
+
+        const double tone = params.startHz > 0.0 ? std::sin(phase) : 0.0;
+        const double envelope = std::min(1.0, static_cast<double>(frame) / attack) * std::exp(-t / params.decay);
+        const double value = (tone * (1.0 - params.noise) + white * params.noise) * envelope;
+        const Sint16 sample = static_cast<Sint16>(value * 28000.0);
+        for (int c = 0; c < channels; c++) samples[frame * channels + c] = sample;
+    }
+
+    // Le chunk lit les échantillons sur place (ils restent à la charge de la banque)
+    chunks[sound] = Mix_QuickLoad_RAW(reinterpret_cast<Uint8*>(samples.data()),
+                                      static_cast<Uint32>(samples.size() * sizeof(Sint16)));
+    if (chunks[sound]) Mix_VolumeChunk(chunks[sound], params.volume);
+}
+
+void SoundBank::play(Sound sound) {
+    if (!loaded || !chunks[sound]) return;
+
+    // Canal libre, sinon le plus ancien : il est arrêté avant de noter le
+    // déclenchement, pour que la mesure ne relève pas l'effet remplacé
+    int channel = Mix_GroupAvailable(-1);
+    if (channel < 0) {
+        channel = Mix_GroupOldest(-1);
+        if (channel < 0) return;
+        Mix_HaltChannel(channel);
+    }
+    if (channel >= CHANNELS) return;
+
+    pendingTrigger[channel].store(SDL_GetPerformanceCounter(), std::memory_order_release);
+    Mix_PlayChannel(channel, chunks[sound], 0);
+}
+
+double SoundBank::getAverageLatencyMs() const {
+    const Uint64 count = latencyCount.load(std::memory_order_relaxed);
+    return count > 0 ? latencySumMicros.load(std::memory_order_relaxed) / 1000.0 / count : 0.0;
+}
+
+double SoundBank::getMaxLatencyMs() const {
+    return latencyMaxMicros.load(std::memory_order_relaxed) / 1000.0;
+}
+
+void SoundBank::postMix(void* udata, Uint8* stream, int len) {
+    (void)stream;
+    SoundBank* bank = static_cast<SoundBank*>(udata);
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const double counterFrequency = static_cast<double>(SDL_GetPerformanceFrequency());
+
+    // Le bloc qui vient d'être mixé sort après celui que joue le périphérique :
+    // sa durée s'ajoute au délai déjà écoulé
+    const int frames = len / static_cast<int>(sizeof(Sint16) * bank->channels);
+    const Uint64 blockMicros = static_cast<Uint64>(frames) * 1000000 / bank->frequency;
+
+    // Mix_PlayChannel prend le verrou audio : un canal qui joue pendant ce
+    // callback a été lancé avant le mixage du bloc, et y a donc été mixé
+    for (int channel = 0; channel < CHANNELS; channel++) {
+        Uint64 trigger = bank->pendingTrigger[channel].load(std::memory_order_acquire);
+        if (trigger == 0 || !Mix_Playing(channel)) continue;
+        if (!bank->pendingTrigger[channel].compare_exchange_strong(trigger, 0)) continue;
+
+        const Uint64 micros = static_cast<Uint64>((now - trigger) * 1000000.0 / counterFrequency) + blockMicros;
+        bank->latencySumMicros.fetch_add(micros, std::memory_order_relaxed);
+        bank->latencyCount.fetch_add(1, std::memory_order_relaxed);
+        Uint64 previous = bank->latencyMaxMicros.load(std::memory_order_relaxed);
+        while (micros > previous && !bank->latencyMaxMicros.compare_exchange_weak(previous, micros)) {
+        }
+    }
+}
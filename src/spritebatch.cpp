@@ -0,0 +1,204 @@
+#include "../headers/spritebatch.hpp"
+#include <algorithm>
+#include <iostream>
+
+/*
+File de rendu triée
+Les clés de tri sont des entiers 64 bits : couche (8 bits), tranche (8 bits),
+identifiant de texture (16 bits) et indice de soumission (32 bits). Trier les
+clés plutôt que les quads évite de déplacer les sommets, et l'indice garantit
+un tri stable. La tranche conserve l'ordre de soumission entre quads qui se
+recouvrent : sans elle, tous les rectangles (texture 0) d'une couche
+passeraient sous ses sprites.
+*/
+
+SpriteBatch::SpriteBatch(size_t capacity) :
+    frameDrawCalls(0),
+    frameVertices(0),
+    lastDrawCalls(0),
+    frames(0),
+    totalDrawCalls(0),
+    totalVertices(0),
+    maxDrawCalls(0) {
+    quads.reserve(capacity);
+    keys.reserve(capacity);
+    bands.reserve(capacity);
+    vertexBuffer.reserve(capacity * 4);
+    indexBuffer.reserve(capacity * 6);
+    textureIds.reserve(16);
+}
+
+void SpriteBatch::beginFrame() {
+    frameDrawCalls = 0;
+    frameVertices = 0;
+}
+
+void SpriteBatch::endFrame() {
+    frames++;
+    lastDrawCalls = frameDrawCalls;
+    totalDrawCalls += frameDrawCalls;
+    totalVertices += frameVertices;
+    if (frameDrawCalls > maxDrawCalls) maxDrawCalls = frameDrawCalls;
+}
+
+void SpriteBatch::draw(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst, int layer) {
+    if (!texture) return;
+
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (src) {
+        int w, h;
+        if (SDL_QueryTexture(texture, nullptr, nullptr, &w, &h) != 0 || w == 0 || h == 0) return;
+        u0 = static_cast<float>(src->x) / w;
+        v0 = static_cast<float>(src->y) / h;
+        u1 = static_cast<float>(src->x + src->w) / w;
+        v1 = static_cast<float>(src->y + src->h) / h;
+    }
+
+    SDL_Color white = {255, 255, 255, 255};
+    addQuad(texture, layer,
+            static_cast<float>(dst.x), static_cast<float>(dst.y),
+            static_cast<float>(dst.x + dst.w), static_cast<float>(dst.y + dst.h),
+            u0, v0, u1, v1, white);
+}
+
+void SpriteBatch::fillRect(const SDL_Rect& rect, SDL_Color color, int layer) {
+    addQuad(nullptr, layer,
+            static_cast<float>(rect.x), static_cast<float>(rect.y),
+            static_cast<float>(rect.x + rect.w), static_cast<float>(rect.y + rect.h),
+            0.0f, 0.0f, 0.0f, 0.0f, color);
+}
+
+void SpriteBatch::drawRect(const SDL_Rect& rect, SDL_Color color, int layer) {
+    SDL_Rect top = {rect.x, rect.y, rect.w, 1};
+    SDL_Rect bottom = {rect.x, rect.y + rect.h - 1, rect.w, 1};
+    SDL_Rect left = {rect.x, rect.y + 1, 1, rect.h - 2};
+    SDL_Rect right = {rect.x + rect.w - 1, rect.y + 1, 1, rect.h - 2};
+    fillRect(top, color, layer);
+    fillRect(bottom, color, layer);
+    fillRect(left, color, layer);
+    fillRect(right, color, layer);
+}
+
+void SpriteBatch::addQuad(SDL_Texture* texture, int layer,
+                          float x0, float y0, float x1, float y1,
+                          float u0, float v0, float u1, float v1, SDL_Color color) {
+    Quad quad;
+    quad.texture = texture;
+    quad.layer = layer;
+    quad.vertices[0] = {{x0, y0}, color, {u0, v0}};
+    quad.vertices[1] = {{x1, y0}, color, {u1, v0}};
+    quad.vertices[2] = {{x1, y1}, color, {u1, v1}};
+    quad.vertices[3] = {{x0, y1}, color, {u0, v1}};
+    quads.push_back(quad);
+}
+
+Uint32 SpriteBatch::textureId(SDL_Texture* texture) {
+    // Peu de textures distinctes par image : une recherche linéaire suffit
+    for (size_t i = 0; i < textureIds.size(); i++) {
+        if (textureIds[i] == texture) return static_cast<Uint32>(i);
+    }
+    textureIds.push_back(texture);
+    return static_cast<Uint32>(textureIds.size() - 1);
+}
+
+void SpriteBatch::computeBands() {
+    bands.assign(quads.size(), 0);
+
+    // Seules les couches qui mêlent plusieurs textures ont besoin de tranches
+    // (le texte, une seule texture par couche, est laissé d'un seul tenant)
+    Uint32 layerMixed = 0;
+    SDL_Texture* layerTexture[32];
+    Uint32 layerSeen = 0;
+    for (const Quad& quad : quads) {
+        const int layer = quad.layer & 31;
+        if (!(layerSeen & (1u << layer))) {
+            layerSeen |= 1u << layer;
+            layerTexture[layer] = quad.texture;
+        } else if (layerTexture[layer] != quad.texture) {
+            layerMixed |= 1u << layer;
+        }
+    }
+    if (layerMixed == 0) return;
+
+    for (size_t i = 0; i < quads.size(); i++) {
+        const Quad& quad = quads[i];
+        if (!(layerMixed & (1u << (quad.layer & 31)))) continue;
+        const SDL_FPoint a0 = quad.vertices[0].position;
+        const SDL_FPoint a1 = quad.vertices[2].position;
+
+        int band = 0;
+        for (size_t j = 0; j < i; j++) {
+            const Quad& below = quads[j];
+            if (below.layer != quad.layer) continue;
+            const SDL_FPoint b0 = below.vertices[0].position;
+            const SDL_FPoint b1 = below.vertices[2].position;
+            if (a0.x >= b1.x || b0.x >= a1.x || a0.y >= b1.y || b0.y >= a1.y) continue;
+            band = std::max(band, bands[j] + (below.texture != quad.texture ? 1 : 0));
+        }
+        bands[i] = static_cast<Uint8>(std::min(band, 255));
+    }
+}
+
+void SpriteBatch::flush(SDL_Renderer* renderer) {
+    if (quads.empty()) return;
+
+    // Construction et tri des clés
+    computeBands();
+    keys.clear();
+    textureIds.clear();
+    textureIds.push_back(nullptr);  // Les rectangles sans texture ont l'identifiant 0
+    for (size_t i = 0; i < quads.size(); i++) {
+        Uint64 layer = static_cast<Uint64>(quads[i].layer & 0xFF);
+        Uint64 band = static_cast<Uint64>(bands[i]);
+        Uint64 id = static_cast<Uint64>(textureId(quads[i].texture) & 0xFFFF);
+        keys.push_back((layer << 56) | (band << 48) | (id << 32) | static_cast<Uint64>(i));
+    }
+    std::sort(keys.begin(), keys.end());
+
+    // Sommets dans l'ordre trié
+    vertexBuffer.clear();
+    for (Uint64 key : keys) {
+        const Quad& quad = quads[static_cast<Uint32>(key)];
+        vertexBuffer.insert(vertexBuffer.end(), quad.vertices, quad.vertices + 4);
+    }
+
+    // Motif d'indices partagé par tous les groupes
+    size_t needed = quads.size() * 6;
+    for (size_t q = indexBuffer.size() / 6; indexBuffer.size() < needed; q++) {
+        int base = static_cast<int>(q * 4);
+        indexBuffer.push_back(base);
+        indexBuffer.push_back(base + 1);
+        indexBuffer.push_back(base + 2);
+        indexBuffer.push_back(base);
+        indexBuffer.push_back(base + 2);
+        indexBuffer.push_back(base + 3);
+    }
+
+    // Les rectangles sans texture utilisent le mode de mélange du renderer
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    // Un appel de rendu par groupe (couche, tranche, texture) consécutif
+    size_t start = 0;
+    while (start < keys.size()) {
+        const Uint64 group = keys[start] >> 32;
+        size_t end = start + 1;
+        while (end < keys.size() && (keys[end] >> 32) == group) end++;
+
+        const Quad& first = quads[static_cast<Uint32>(keys[start])];
+        int count = static_cast<int>(end - start);
+        SDL_RenderGeometry(renderer, first.texture,
+                           &vertexBuffer[start * 4], count * 4,
+                           indexBuffer.data(), count * 6);
+        frameDrawCalls++;
+        frameVertices += count * 4;
+        start = end;
+    }
+
+    quads.clear();
+}
+
+void SpriteBatch::printStats() const {
+    if (frames == 0) return;
+    std::cout << "Sprite batch: " << static_cast<double>(totalDrawCalls) / frames << " draw calls/frame (max "
+              << maxDrawCalls << "), " << static_cast<double>(totalVertices) / frames << " vertices/frame" << std::endl;
+}
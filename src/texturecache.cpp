@@ -0,0 +1,132 @@
+#include "../headers/texturecache.hpp"
+#include "../headers/profiler.hpp"
+#include "../headers/resampler.hpp"
+#include <iostream>
+
+/*
+Constructeur de la classe TextureCache
+Le renderer est fourni plus tard, une fois la fenêtre créée
+*/
+TextureCache::TextureCache() :
+    renderer(nullptr),
+    hits(0),
+    misses(0),
+    bytesResident(0) {}
+
+TextureCache::~TextureCache() {
+    clear();
+}
+
+void TextureCache::setRenderer(SDL_Renderer* renderer) {
+    this->renderer = renderer;
+}
+
+void TextureCache::setTargetSize(const std::string& path, int width, int height) {
+    targetSizes[path] = {width, height};
+}
+
+bool TextureCache::getTargetSize(const std::string& path, int& width, int& height) const {
+    auto it = targetSizes.find(path);
+    if (it == targetSizes.end()) return false;
+    width = it->second.width;
+    height = it->second.height;
+    return true;
+}
+
+/*
+Emprunte une texture
+Le cas courant (texture déjà chargée) ne coûte qu'une recherche dans la table
+*/
+SDL_Texture* TextureCache::acquire(const std::string& path, const FallbackFactory& fallback) {
+    auto it = entries.find(path);
+    if (it != entries.end()) {
+        it->second.refCount++;
+        hits++;
+        return it->second.texture;
+    }
+
+    // Sans renderer (mode sans affichage), aucune texture ne peut être créée
+    if (!renderer) return nullptr;
+
+    // Décodage et envoi au GPU : le chemin coûteux que le cache doit rendre rare
+    PROFILE_SCOPE("TextureCache decode");
+    misses++;
+    SDL_Surface* surface = IMG_Load(path.c_str());
+    if (!surface) {
+        std::cerr << "Erreur de chargement de l'image " << path << ": " << IMG_GetError() << std::endl;
+        if (!fallback) return nullptr;
+
+        surface = fallback();
+        if (!surface) {
+            std::cerr << "Échec de création de la surface de secours!" << std::endl;
+            return nullptr;
+        }
+    }
+
+    SDL_Texture* texture = createTexture(path, surface);
+    SDL_FreeSurface(surface);  // La surface n'est plus nécessaire une fois la texture créée
+    if (!texture) return nullptr;
+
+    Entry entry = {texture, 1, textureBytes(texture)};
+    bytesResident += entry.bytes;
+    entries.emplace(path, entry);
+    return texture;
+}
+
+bool TextureCache::preload(const std::string& path, SDL_Surface* surface) {
+    if (entries.find(path) != entries.end()) return true;
+    if (!renderer || !surface) return false;
+
+    PROFILE_SCOPE("TextureCache upload");
+    SDL_Texture* texture = createTexture(path, surface);
+    if (!texture) return false;
+
+    // Aucun emprunteur pour l'instant : le compteur passera à 1 au premier acquire()
+    Entry entry = {texture, 0, textureBytes(texture)};
+    bytesResident += entry.bytes;
+    entries.emplace(path, entry);
+    return true;
+}
+
+void TextureCache::release(const std::string& path) {
+    auto it = entries.find(path);
+    if (it == entries.end()) return;
+
+    if (--it->second.refCount <= 0) {
+        bytesResident -= it->second.bytes;
+        SDL_DestroyTexture(it->second.texture);
+        entries.erase(it);
+    }
+}
+
+void TextureCache::clear() {
+    for (auto& pair : entries) {
+        SDL_DestroyTexture(pair.second.texture);
+    }
+    entries.clear();
+    bytesResident = 0;
+}
+
+SDL_Texture* TextureCache::createTexture(const std::string& path, SDL_Surface* surface) {
+    // Réduction à la taille d'affichage : moins de mémoire et de filtrage à chaque copie
+    SDL_Surface* resized = nullptr;
+    auto it = targetSizes.find(path);
+    if (it != targetSizes.end() && (surface->w != it->second.width || surface->h != it->second.height)) {
+        PROFILE_SCOPE("TextureCache resample");
+        resized = resampleSurface(surface, it->second.width, it->second.height);
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, resized ? resized : surface);
+    if (resized) SDL_FreeSurface(resized);
+    if (!texture) {
+        std::cerr << "Échec de création de la texture: " << SDL_GetError() << std::endl;
+    }
+    return texture;
+}
+
+size_t TextureCache::textureBytes(SDL_Texture* texture) {
+    Uint32 format = 0;
+    int w = 0, h = 0;
+    if (SDL_QueryTexture(texture, &format, nullptr, &w, &h) != 0) return 0;
+    return static_cast<size_t>(w) * h * SDL_BYTESPERPIXEL(format);
+}
@@ -0,0 +1,100 @@
+#include "../headers/threadpool.hpp"
+#include "../headers/profiler.hpp"
+
+ThreadPool::ThreadPool(unsigned int threads, const char* name) :
+    activeTasks(0),
+    stopping(false),
+    batch(nullptr),
+    batchSize(0),
+    batchNext(0),
+    batchPending(0) {
+    if (threads == 0) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        threads = cores > 1 ? cores - 1 : 1;
+    }
+
+    workers.reserve(threads);
+    for (unsigned int i = 0; i < threads; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, name);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    allDone.wait(lock, [this]() { return tasks.empty() && activeTasks == 0; });
+}
+
+void ThreadPool::runJobs(const Job* jobs, size_t count) {
+    std::unique_lock<std::mutex> lock(mutex);
+    batch = jobs;
+    batchSize = count;
+    batchNext = 0;
+    batchPending = count;
+    taskAvailable.notify_all();
+
+    drainBatch(lock);
+    batchDone.wait(lock, [this]() { return batchPending == 0; });
+    batch = nullptr;
+    batchSize = 0;
+    batchNext = 0;
+}
+
+void ThreadPool::drainBatch(std::unique_lock<std::mutex>& lock) {
+    while (batchNext < batchSize) {
+        const Job job = batch[batchNext++];
+        lock.unlock();
+        job.run(job.data);
+        lock.lock();
+        if (--batchPending == 0) batchDone.notify_all();
+    }
+}
+
+void ThreadPool::workerLoop(const char* name) {
+    Profiler::setThreadName(name);
+
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this]() { return stopping || !tasks.empty() || batchNext < batchSize; });
+
+            // Un lot en cours passe avant la file
+            if (batchNext < batchSize) {
+                drainBatch(lock);
+                continue;
+            }
+            // Les tâches restantes sont exécutées avant l'arrêt
+            if (tasks.empty()) return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            activeTasks++;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeTasks--;
+            if (tasks.empty() && activeTasks == 0) allDone.notify_all();
+        }
+    }
+}
@@ -1,12 +1,23 @@
 #include "../headers/timer.hpp"
 
 Timer::Timer() : 
+    clock(nullptr),
+    clockData(nullptr),
     startTicks(0), 
     pausedTicks(0), 
     totalDuration(0),
     paused(false), 
     started(false) {}
 
+void Timer::setClock(Clock clock, void* userdata) {
+    this->clock = clock;
+    clockData = userdata;
+}
+
+Uint32 Timer::now() const {
+    return clock ? clock(clockData) : SDL_GetTicks();
+}
+
 void Timer::start(int seconds) {
     started = true;
     paused = false;
@@ -15,7 +26,7 @@ void Timer::start(int seconds) {
     totalDuration = seconds * 1000;
     
     // Obtenir le temps actuel
-    startTicks = SDL_GetTicks();
+    startTicks = now();
 }
 
 void Timer::stop() {
@@ -30,7 +41,7 @@ void Timer::pause() {
         paused = true;
         
         // Calculer le temps écoulé et le sauvegarder
-        pausedTicks = SDL_GetTicks() - startTicks;
+        pausedTicks = now() - startTicks;
         startTicks = 0;
     }
 }
@@ -40,7 +51,7 @@ void Timer::resume() {
         paused = false;
         
         // Réinitialiser le point de départ
-        startTicks = SDL_GetTicks() - pausedTicks;
+        startTicks = now() - pausedTicks;
         pausedTicks = 0;
     }
 }
@@ -52,7 +63,7 @@ int Timer::getRemainingTime() const {
         if (paused) {
             elapsedMs = pausedTicks;
         } else {
-            elapsedMs = SDL_GetTicks() - startTicks;
+            elapsedMs = now() - startTicks;
         }
         
         // Calculer le temps restant en secondes
@@ -77,7 +88,7 @@ bool Timer::isTimeUp() const {
         if (paused) {
             elapsedMs = pausedTicks;
         } else {
-            elapsedMs = SDL_GetTicks() - startTicks;
+            elapsedMs = now() - startTicks;
         }
         
         return elapsedMs >= totalDuration;
@@ -0,0 +1,181 @@
+#include "../headers/vecenv.hpp"
+#include "../headers/profiler.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    // Action du joueur correspondant à chaque action d'agent (NOOP : aucune)
+    const InputAction INPUT_ACTIONS[VecEnv::ACTION_COUNT] = {
+        ACTION_COUNT, ACTION_MOVE_LEFT, ACTION_MOVE_RIGHT, ACTION_SPEED_UP, ACTION_SPEED_DOWN
+    };
+
+    // Huit voies d'un masque en huit octets d'observation (bit i -> octet i, 0 ou 1)
+    struct ByteSpread {
+        Uint64 bytes[256];
+    };
+
+    constexpr ByteSpread makeByteSpread() {
+        ByteSpread table = {};
+        for (int bits = 0; bits < 256; bits++) {
+            for (int lane = 0; lane < 8; lane++) {
+                if (bits >> lane & 1) table.bytes[bits] |= 1ULL << (8 * lane);
+            }
+        }
+        return table;
+    }
+
+    constexpr ByteSpread BYTE_SPREAD = makeByteSpread();
+    static_assert(SDL_BYTEORDER == SDL_LIL_ENDIAN, "BYTE_SPREAD range la voie 0 dans l'octet de poids faible");
+}
+
+VecEnv::VecEnv(size_t count, ThreadPool& pool, int ticksPerStep, const TrackConfig& track) :
+    count(count),
+    pool(pool),
+    ticksPerStep(std::max(1, ticksPerStep)),
+    track(&track),
+    obsSize(OBS_ROWS * track.lanes + 2),
+    clocks(count),
+    rngs(count),
+    stepActions(nullptr),
+    observations(count * obsSize),
+    rewards(count),
+    dones(count),
+    wins(count) {
+    // Chaque partie lit sa propre horloge : clocks n'est plus redimensionné
+    races.reserve(count);
+    for (size_t env = 0; env < count; env++) {
+        races.emplace_back(static_cast<size_t>(MAX_OBSTACLES));
+        races[env].setTrack(track);
+        races[env].setClock(&VecEnv::envClock, &clocks[env]);
+    }
+
+    // Blocs contigus de taille égale, le dernier plus court ; un seul bloc si
+    // les parties sont trop peu nombreuses pour être réparties
+    const size_t blockCount = std::min(pool.size() + 1, std::max<size_t>(1, count / MIN_BLOCK));
+    const size_t blockSize = (count + blockCount - 1) / blockCount;
+    blocks.reserve(blockCount);
+    for (size_t begin = 0; begin < count; begin += blockSize) {
+        Block block = { this, begin, std::min(count, begin + blockSize) };
+        blocks.push_back(block);
+    }
+    jobs.reserve(blocks.size());
+    for (Block& block : blocks) {
+        ThreadPool::Job job = { &VecEnv::runBlock, &block };
+        jobs.push_back(job);
+    }
+}
+
+Uint32 VecEnv::envClock(void* clock) {
+    return static_cast<Uint32>(*static_cast<const double*>(clock));
+}
+
+void VecEnv::reset(const Uint64* seeds) {
+    for (size_t env = 0; env < count; env++) {
+        rngs[env].seed(seeds[env], 1);
+        resetEnv(env);
+        rewards[env] = 0.0f;
+        dones[env] = 0;
+        wins[env] = 0;
+        observe(env);
+    }
+}
+
+void VecEnv::resetEnv(size_t env) {
+    clocks[env] = 0.0;
+    races[env].start();
+}
+
+/*
+Répartition par blocs contigus : chaque thread écrit des lignes distinctes de
+chaque tableau, le thread appelant prend sa part des blocs
+*/
+void VecEnv::step(const Uint8* actions) {
+    PROFILE_SCOPE("VecEnv::step");
+    if (jobs.size() <= 1) {
+        stepRange(0, count, actions);
+        return;
+    }
+
+    stepActions = actions;
+    pool.runJobs(jobs.data(), jobs.size());
+    stepActions = nullptr;
+}
+
+void VecEnv::runBlock(void* block) {
+    const Block& range = *static_cast<const Block*>(block);
+    range.env->stepRange(range.begin, range.end, range.env->stepActions);
+}
+
+/*
+Un pas d'agent : l'action, puis ticksPerStep pas de simulation joués par la
+Race, l'horloge de la partie avançant avant chaque pas comme dans Game
+*/
+void VecEnv::stepRange(size_t begin, size_t end, const Uint8* actions) {
+    for (size_t env = begin; env < end; env++) {
+        Race& race = races[env];
+        if (actions[env] < ACTION_COUNT) race.applyAction(INPUT_ACTIONS[actions[env]]);
+
+        float reward = 0.0f;
+        Race::Outcome outcome = Race::RUNNING;
+        for (int t = 0; t < ticksPerStep && outcome == Race::RUNNING; t++) {
+            clocks[env] += SIM_STEP_MS;
+            outcome = race.tick(rngs[env], true);
+            if (outcome == Race::RUNNING) reward += SIM_DT;
+        }
+
+        rewards[env] = reward + outcome;
+        dones[env] = outcome != Race::RUNNING;
+        wins[env] = outcome == Race::TIME_UP;
+        if (outcome != Race::RUNNING) resetEnv(env);
+        observe(env);
+    }
+}
+
+void VecEnv::observe(size_t env) {
+    const Race& race = races[env];
+    const int lanes = track->lanes;
+    Uint8* obs = &observations[env * obsSize];
+    const int rowHeight = WINDOW_HEIGHT / OBS_ROWS;
+
+    if (race.usesGrid()) {
+        // Pistes larges : masque des voies occupées par ligne d'observation (OU des
+        // rangées de la grille qui la recouvrent), puis un octet par voie
+        const OccupancyGrid& grid = race.getGrid();
+        Uint64 masks[OBS_ROWS] = {0};
+        for (int index = grid.getFirstVisibleRow(); index < grid.getRowCount(); index++) {
+            const Uint64 row = grid.getRow(index);
+            const int top = static_cast<int>(grid.getRowY(index));
+            const int bottom = top + OccupancyGrid::ROW_HEIGHT - 1;
+            if (row == 0 || bottom < 0 || top >= WINDOW_HEIGHT) continue;
+            const int first = std::max(0, top) / rowHeight;
+            const int last = std::min(WINDOW_HEIGHT - 1, bottom) / rowHeight;
+            for (int obsRow = first; obsRow <= last; obsRow++) masks[obsRow] |= row;
+        }
+        for (int obsRow = 0; obsRow < OBS_ROWS; obsRow++) {
+            Uint8* line = obs + obsRow * lanes;
+            int lane = 0;
+            for (; lane + 8 <= lanes; lane += 8) {
+                std::memcpy(line + lane, &BYTE_SPREAD.bytes[masks[obsRow] >> lane & 0xFF], 8);
+            }
+            for (; lane < lanes; lane++) {
+                line[lane] = static_cast<Uint8>(masks[obsRow] >> lane & 1);
+            }
+        }
+    } else {
+        const ObstaclePool& walls = race.getWalls();
+        std::fill(obs, obs + OBS_ROWS * lanes, 0);
+        for (size_t i = 0; i < walls.size(); i++) {
+            const int top = static_cast<int>(walls.getY(i));
+            const int bottom = top + walls.getHeight(i) - 1;
+            if (bottom < 0 || top >= WINDOW_HEIGHT) continue;
+            const int first = std::max(0, top) / rowHeight;
+            const int last = std::min(WINDOW_HEIGHT - 1, bottom) / rowHeight;
+            for (int row = first; row <= last; row++) {
+                obs[row * lanes + walls.getLane(i)] = 1;
+            }
+        }
+    }
+
+    obs[OBS_ROWS * lanes] = static_cast<Uint8>(race.getLane());
+    obs[OBS_ROWS * lanes + 1] = static_cast<Uint8>(race.getSpeed());
+}
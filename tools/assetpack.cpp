@@ -0,0 +1,172 @@
+/* assetpack.cpp
+Outil hors ligne : construit l'archive de ressources du jeu
+
+Les images sont décodées une fois pour toutes, redimensionnées à leur taille
+d'affichage et converties en RGBA ; la police et les musiques sont copiées
+telles quelles. Le jeu projette ensuite l'archive en mémoire au démarrage
+(voir AssetArchive).
+
+Usage : assetpack [sortie]   (par défaut assets.pak, à lancer depuis la racine du projet) */
+
+#include "../headers/assetarchive.hpp"
+#include "../headers/GameConstants.hpp"
+#include "../headers/resampler.hpp"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+    /* Ressource à empaqueter (largeur nulle : fichier copié tel quel) */
+    struct Source {
+        const char* path;
+        int width;
+        int height;
+    };
+
+    // Fichiers copiés tels quels (les images sont celles de IMAGE_DRAW_SIZES)
+    const char* const BLOBS[] = {FONT_PATH, MENU_MUSIC_PATH, GAME_MUSIC_PATH, GAME_OVER_SOUND_PATH};
+
+    struct Packed {
+        PakEntry entry;
+        std::vector<Uint8> data;
+    };
+
+    /* Décode une image et la redimensionne en RGBA à la taille demandée */
+    bool packImage(const Source& source, Packed& packed) {
+        SDL_Surface* image = IMG_Load(source.path);
+        if (!image) {
+            std::cerr << "Cannot load " << source.path << ": " << IMG_GetError() << std::endl;
+            return false;
+        }
+
+        // Même filtre par zone que le chargement à l'exécution
+        SDL_Surface* scaled = resampleSurface(image, source.width, source.height);
+        bool ok = scaled != nullptr;
+
+        if (ok) {
+            const size_t rowBytes = static_cast<size_t>(source.width) * 4;
+            packed.entry.type = PAK_IMAGE;
+            packed.entry.width = source.width;
+            packed.entry.height = source.height;
+            packed.entry.pitch = static_cast<Uint32>(rowBytes);
+            packed.data.resize(rowBytes * source.height);
+            for (int y = 0; y < source.height; y++) {
+                std::memcpy(&packed.data[y * rowBytes], static_cast<Uint8*>(scaled->pixels) + y * scaled->pitch, rowBytes);
+            }
+            std::cout << source.path << ": " << image->w << "x" << image->h << " -> "
+                      << source.width << "x" << source.height << std::endl;
+        }
+
+        if (scaled) SDL_FreeSurface(scaled);
+        SDL_FreeSurface(image);
+        return ok;
+    }
+
+    /* Copie le contenu brut d'un fichier */
+    bool packBlob(const Source& source, Packed& packed) {
+        SDL_RWops* rw = SDL_RWFromFile(source.path, "rb");
+        if (!rw) {
+            std::cerr << "Cannot open " << source.path << ": " << SDL_GetError() << std::endl;
+            return false;
+        }
+
+        Sint64 size = SDL_RWsize(rw);
+        bool ok = size > 0;
+        if (ok) {
+            packed.data.resize(static_cast<size_t>(size));
+            ok = SDL_RWread(rw, packed.data.data(), 1, packed.data.size()) == packed.data.size();
+        }
+        SDL_RWclose(rw);
+
+        packed.entry.type = PAK_BLOB;
+        std::cout << source.path << ": " << packed.data.size() << " bytes" << std::endl;
+        return ok;
+    }
+
+    Uint64 alignUp(Uint64 value) {
+        return (value + PAK_ALIGNMENT - 1) / PAK_ALIGNMENT * PAK_ALIGNMENT;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const char* outputPath = argc > 1 ? argv[1] : ASSET_ARCHIVE_PATH;
+
+    if (SDL_Init(0) < 0 || !(IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG) & IMG_INIT_PNG)) {
+        std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    std::vector<Source> sources;
+    for (const ImageDrawSize& image : IMAGE_DRAW_SIZES) {
+        sources.push_back({image.path, image.width, image.height});
+    }
+    for (const char* path : BLOBS) {
+        sources.push_back({path, 0, 0});
+    }
+
+    // Les ressources absentes sont ignorées : le jeu les chargera depuis assets/
+    std::vector<Packed> packed;
+    for (const Source& source : sources) {
+        Packed item;
+        std::memset(&item.entry, 0, sizeof(item.entry));
+        if (std::strlen(source.path) >= sizeof(item.entry.name)) {
+            std::cerr << "Path too long for the archive index: " << source.path << std::endl;
+            continue;
+        }
+        std::strcpy(item.entry.name, source.path);
+
+        bool ok = source.width > 0 ? packImage(source, item) : packBlob(source, item);
+        if (ok) {
+            packed.push_back(std::move(item));
+        } else {
+            std::cerr << "Skipping " << source.path << std::endl;
+        }
+    }
+
+    // Index trié par nom (recherche dichotomique au chargement)
+    std::sort(packed.begin(), packed.end(), [](const Packed& a, const Packed& b) {
+        return std::strcmp(a.entry.name, b.entry.name) < 0;
+    });
+
+    PakHeader header;
+    std::memcpy(header.magic, PAK_MAGIC, sizeof(PAK_MAGIC));
+    header.entryCount = static_cast<Uint32>(packed.size());
+    header.reserved = 0;
+
+    Uint64 offset = alignUp(sizeof(PakHeader) + packed.size() * sizeof(PakEntry));
+    for (Packed& item : packed) {
+        item.entry.offset = offset;
+        item.entry.size = item.data.size();
+        offset = alignUp(offset + item.data.size());
+    }
+
+    FILE* file = std::fopen(outputPath, "wb");
+    if (!file) {
+        std::cerr << "Cannot write " << outputPath << std::endl;
+        return 1;
+    }
+
+    std::fwrite(&header, sizeof(header), 1, file);
+    for (const Packed& item : packed) {
+        std::fwrite(&item.entry, sizeof(item.entry), 1, file);
+    }
+
+    static const Uint8 padding[PAK_ALIGNMENT] = {0};
+    for (const Packed& item : packed) {
+        long position = std::ftell(file);
+        std::fwrite(padding, 1, static_cast<size_t>(item.entry.offset - position), file);
+        std::fwrite(item.data.data(), 1, item.data.size(), file);
+    }
+    bool ok = std::ferror(file) == 0;
+    std::fclose(file);
+
+    std::cout << "Wrote " << packed.size() << " assets (" << offset / 1024 << " KiB) to " << outputPath << std::endl;
+
+    IMG_Quit();
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
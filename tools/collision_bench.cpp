@@ -0,0 +1,75 @@
+/* collision_bench.cpp
+Mesure de la phase large des collisions (ObstaclePool::collides)
+
+Pour chaque taille, la réserve est remplie de murs répartis sur les voies et sur
+une hauteur proportionnelle à leur nombre (niveau dense). À chaque pas, les murs
+avancent, ceux sortis de l'écran sont remplacés en haut, puis la boîte du vélo
+est testée par la phase large et par la passe linéaire : les deux résultats
+doivent être identiques.
+
+Usage : collision_bench [pas] [vitesses mélangées (0/1)]
+        (par défaut 2000 pas, tous les murs à WALL_SPEED) */
+
+#include "../headers/obstaclepool.hpp"
+#include "../headers/random.hpp"
+#include <SDL2/SDL.h>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+    const size_t SIZES[] = {16, 256, 4096, 16384, 65536};
+
+    void addWall(ObstaclePool& pool, Pcg32& rng, float top, float bottom, bool mixedSpeeds) {
+        const int lane = static_cast<int>(rng.nextBelow(LANES));
+        const int x = lane * LANE_WIDTH + (LANE_WIDTH - WALL_WIDTH) / 2;
+        const float y = top + (bottom - top) * (rng.nextBelow(1 << 16) / 65536.0f);
+        const int speed = mixedSpeeds ? WALL_SPEED + static_cast<int>(rng.nextBelow(120)) : WALL_SPEED;
+        pool.add(lane, x, y, WALL_WIDTH, WALL_HEIGHT, speed);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int steps = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const bool mixedSpeeds = argc > 2 && std::atoi(argv[2]) != 0;
+    const double toNanos = 1e9 / SDL_GetPerformanceFrequency();
+
+    for (size_t size : SIZES) {
+        ObstaclePool pool(size);
+        Pcg32 rng(size, 4);
+
+        // Environ un mur toutes les 20 lignes de pixels et par voie
+        const float span = static_cast<float>(size) * 20.0f / LANES;
+        while (!pool.full()) addWall(pool, rng, -span, static_cast<float>(WINDOW_HEIGHT), mixedSpeeds);
+
+        Uint64 broadTime = 0;
+        Uint64 linearTime = 0;
+        int hits = 0;
+        int mismatches = 0;
+        for (int s = 0; s < steps; s++) {
+            pool.update(BIKE_START_SPEED);
+            pool.cullOffScreen();
+            while (!pool.full()) addWall(pool, rng, -span, -static_cast<float>(WALL_HEIGHT), mixedSpeeds);
+
+            // Vélo dans une voie ou à cheval entre deux
+            const int x = static_cast<int>(rng.nextBelow(WINDOW_WIDTH - BIKE_WIDTH));
+            const SDL_Rect box = {x + 5, BIKE_Y + 5, BIKE_WIDTH - 10, BIKE_HEIGHT - 10};
+
+            Uint64 start = SDL_GetPerformanceCounter();
+            const bool broad = pool.collides(box);
+            Uint64 middle = SDL_GetPerformanceCounter();
+            const bool linear = pool.collidesLinear(box);
+            Uint64 end = SDL_GetPerformanceCounter();
+
+            broadTime += middle - start;
+            linearTime += end - middle;
+            hits += broad;
+            mismatches += broad != linear;
+        }
+
+        std::cout << size << " obstacles: broad phase " << broadTime * toNanos / steps << " ns, linear "
+                  << linearTime * toNanos / steps << " ns per test (" << hits << " hits, "
+                  << mismatches << " mismatches)" << std::endl;
+        if (mismatches != 0) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+/* grid_bench.cpp
+Mesure du monde en grille d'occupation (OccupancyGrid) sur des pistes larges
+
+Pour chaque nombre de voies, la même suite de vagues de murs est jouée par la
+grille et par une liste de murs (un objet par mur, passe linéaire pour la
+collision) : défilement, génération et collision du vélo à chaque pas.
+Les nombres de collisions diffèrent un peu : la grille arrondit la position
+des murs à la rangée.
+
+Usage : grid_bench [pas]   (par défaut 100000 pas de simulation) */
+
+#include "../headers/occupancygrid.hpp"
+#include "../headers/random.hpp"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+    const int LANE_COUNTS[] = {3, 8, 16, 32, 64};
+
+    // Vague : quelques rangées au-dessus de l'écran, environ 3 voies sur 8 occupées
+    const int WAVE_ROWS = 6;
+    const int WAVE_INTERVAL_TICKS = OBSTACLE_INTERVAL_MS * SIM_HZ / 1000;
+
+    struct Wall {
+        int lane;
+        float y;
+    };
+
+    Uint64 next64(Pcg32& rng) {
+        return (static_cast<Uint64>(rng.next()) << 32) | rng.next();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int steps = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const double toNanos = 1e9 / SDL_GetPerformanceFrequency();
+    const float dy = (WALL_SPEED + (BIKE_START_SPEED / 2) * VELO_SPEED_SCALE) * SIM_DT;
+
+    for (int lanes : LANE_COUNTS) {
+        OccupancyGrid grid(lanes, LANE_WIDTH, WAVE_ROWS * OccupancyGrid::ROW_HEIGHT);
+        std::vector<Wall> walls;
+        walls.reserve(static_cast<size_t>(lanes) * WAVE_ROWS * 8);
+
+        Pcg32 rng(lanes, 5);
+        Uint64 gridTime = 0;
+        Uint64 listTime = 0;
+        int gridHits = 0;
+        int listHits = 0;
+        int bikeLane = lanes / 2;
+
+        for (int s = 0; s < steps; s++) {
+            // Vague de murs, commune aux deux représentations (hors mesure)
+            Uint64 wave[WAVE_ROWS] = {0};
+            const bool spawning = s % WAVE_INTERVAL_TICKS == 0;
+            if (spawning) {
+                for (int row = 0; row < WAVE_ROWS; row++) {
+                    wave[row] = next64(rng) & (next64(rng) | next64(rng)) & grid.getAllLanes();
+                }
+            }
+            if (s % 30 == 0) {
+                bikeLane = std::min(lanes - 1, std::max(0, bikeLane + static_cast<int>(rng.nextBelow(3)) - 1));
+            }
+            const int bikeX = bikeLane * LANE_WIDTH + (LANE_WIDTH - BIKE_WIDTH) / 2 + 5;
+            const int bikeTop = BIKE_Y + 5;
+            const int bikeBottom = BIKE_Y + BIKE_HEIGHT - 5;
+
+            // Grille : défilement, vague par rangée, ET des masques
+            Uint64 start = SDL_GetPerformanceCounter();
+            grid.scroll(dy);
+            if (spawning) {
+                for (int row = 0; row < WAVE_ROWS; row++) {
+                    grid.placeMask(wave[row], static_cast<float>((row - WAVE_ROWS) * OccupancyGrid::ROW_HEIGHT));
+                }
+            }
+            gridHits += grid.collides(grid.getLaneMask(bikeX, BIKE_WIDTH - 10), bikeTop, bikeBottom);
+            Uint64 middle = SDL_GetPerformanceCounter();
+
+            // Liste : un objet par mur, élimination et collision linéaires
+            for (size_t i = walls.size(); i-- > 0;) {
+                walls[i].y += dy;
+                if (walls[i].y > WINDOW_HEIGHT) {
+                    walls[i] = walls.back();
+                    walls.pop_back();
+                }
+            }
+            if (spawning) {
+                for (int row = 0; row < WAVE_ROWS; row++) {
+                    for (int lane = 0; lane < lanes; lane++) {
+                        if (wave[row] & (1ULL << lane)) {
+                            walls.push_back({lane, static_cast<float>((row - WAVE_ROWS) * OccupancyGrid::ROW_HEIGHT)});
+                        }
+                    }
+                }
+            }
+            for (const Wall& wall : walls) {
+                const int ox = wall.lane * LANE_WIDTH;
+                const int oy = static_cast<int>(wall.y);
+                if (bikeX < ox + LANE_WIDTH && bikeX + BIKE_WIDTH - 10 > ox && bikeTop < oy + WALL_HEIGHT && bikeBottom > oy) {
+                    listHits++;
+                    break;
+                }
+            }
+            Uint64 end = SDL_GetPerformanceCounter();
+
+            gridTime += middle - start;
+            listTime += end - middle;
+        }
+
+        std::cout << lanes << " lanes: grid " << gridTime * toNanos / steps << " ns, list "
+                  << listTime * toNanos / steps << " ns per tick (" << walls.size() << " walls alive, hit ticks "
+                  << gridHits << " / " << listHits << ")" << std::endl;
+    }
+    return 0;
+}
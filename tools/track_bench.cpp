@@ -0,0 +1,117 @@
+/* track_bench.cpp
+Mesure des chemins spécialisés par piste (TrackLayout) face au calcul dynamique
+
+Une même suite d'opérations est jouée pour chaque piste proposée :
+- Changement de voie du vélo et lecture de sa position cible
+- Voies recouvertes par sa boîte de collision (phase large)
+- Toutes les 16 opérations, une vague de murs sur toutes les voies
+Trois variantes :
+- spécialisée : TrackLayout<N>, constantes connues à la compilation
+- table : TrackConfig choisie à l'exécution, comme dans le jeu
+- dynamique : nombre de voies à l'exécution, positions recalculées par divisions
+Les trois doivent donner la même somme de contrôle.
+
+Usage : track_bench [opérations]   (par défaut 20000000) */
+
+#include "../headers/trackconfig.hpp"
+#include "../headers/random.hpp"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+    // Changement de voie : -1, 0 ou +1 (sans branchement, pour mesurer les calculs de position)
+    int laneMove(Uint8 op) { return ((op >> 1) & 1) - (op & 1); }
+
+    // Décalage de la boîte du vélo (0 à 63 pixels) : glissement entre deux voies
+    int boxOffset(Uint8 op) { return (op >> 2) - 32; }
+
+    template <class Layout>
+    Uint64 runSpecialised(const std::vector<Uint8>& ops) {
+        Uint64 sum = 0;
+        int lane = Layout::LANE_COUNT / 2;
+        for (size_t i = 0; i < ops.size(); i++) {
+            const Uint8 op = ops[i];
+            lane = std::min(Layout::LANE_COUNT - 1, std::max(0, lane + laneMove(op)));
+            const int x = Layout::BIKE_X.x[lane];
+            const int boxX = std::max(0, x + boxOffset(op));
+            sum += x + Layout::laneAt(boxX) + std::min(Layout::LANE_COUNT - 1, Layout::laneAt(boxX + BIKE_WIDTH - 1));
+
+            if ((i & 15) == 0) {
+                for (int wall = 0; wall < Layout::LANE_COUNT; wall++) sum += Layout::WALL_X.x[wall];
+            }
+        }
+        return sum;
+    }
+
+    Uint64 runTable(const TrackConfig& track, const std::vector<Uint8>& ops) {
+        Uint64 sum = 0;
+        int lane = track.lanes / 2;
+        for (size_t i = 0; i < ops.size(); i++) {
+            const Uint8 op = ops[i];
+            lane = std::min(track.lanes - 1, std::max(0, lane + laneMove(op)));
+            const int x = track.bikeX->x[lane];
+            const int boxX = std::max(0, x + boxOffset(op));
+            sum += x + boxX / track.laneWidth + std::min(track.lanes - 1, (boxX + BIKE_WIDTH - 1) / track.laneWidth);
+
+            if ((i & 15) == 0) {
+                for (int wall = 0; wall < track.lanes; wall++) sum += track.wallX->x[wall];
+            }
+        }
+        return sum;
+    }
+
+    Uint64 runDynamic(int lanes, int width, const std::vector<Uint8>& ops) {
+        Uint64 sum = 0;
+        int lane = lanes / 2;
+        for (size_t i = 0; i < ops.size(); i++) {
+            const Uint8 op = ops[i];
+            lane = std::min(lanes - 1, std::max(0, lane + laneMove(op)));
+            const int laneWidth = width / lanes;
+            const int x = lane * laneWidth + (laneWidth - BIKE_WIDTH) / 2;
+            const int boxX = std::max(0, x + boxOffset(op));
+            sum += x + boxX / laneWidth + std::min(lanes - 1, (boxX + BIKE_WIDTH - 1) / laneWidth);
+
+            if ((i & 15) == 0) {
+                const int wallWidth = std::min(laneWidth * 9 / 10, WALL_WIDTH);
+                for (int wall = 0; wall < lanes; wall++) sum += wall * laneWidth + (laneWidth - wallWidth) / 2;
+            }
+        }
+        return sum;
+    }
+
+    template <class Layout>
+    void bench(const std::vector<Uint8>& ops) {
+        // Le nombre de voies passe par une variable volatile : aucune constante pour les variantes à l'exécution
+        volatile int runtimeLanes = Layout::LANE_COUNT;
+        const TrackConfig& track = *findTrackConfig(runtimeLanes);
+        const double toNanos = 1e9 / SDL_GetPerformanceFrequency() / ops.size();
+
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        const Uint64 specialised = runSpecialised<Layout>(ops);
+        Uint64 t1 = SDL_GetPerformanceCounter();
+        const Uint64 table = runTable(track, ops);
+        Uint64 t2 = SDL_GetPerformanceCounter();
+        const Uint64 dynamic = runDynamic(runtimeLanes, WINDOW_WIDTH, ops);
+        Uint64 t3 = SDL_GetPerformanceCounter();
+
+        std::cout << Layout::LANE_COUNT << " lanes: specialised " << (t1 - t0) * toNanos << " ns, table "
+                  << (t2 - t1) * toNanos << " ns, dynamic " << (t3 - t2) * toNanos << " ns per op"
+                  << (specialised == table && table == dynamic ? "" : "  CHECKSUM MISMATCH") << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000000;
+
+    std::vector<Uint8> ops(count);
+    Pcg32 rng(2024, 6);
+    for (Uint8& op : ops) op = static_cast<Uint8>(rng.next());
+
+    bench<TrackLayout<3>>(ops);
+    bench<TrackLayout<5>>(ops);
+    bench<TrackLayout<8>>(ops);
+    return 0;
+}
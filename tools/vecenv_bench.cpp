@@ -0,0 +1,76 @@
+/* vecenv_bench.cpp
+Mesure du débit de l'environnement vectorisé (VecEnv)
+
+Des agents aléatoires jouent N parties en parallèle ; l'outil affiche le nombre
+de pas d'environnement par seconde et le bilan des parties terminées.
+
+Usage : vecenv_bench [parties] [pas] [threads] [pas de simulation par action] [voies]
+        (par défaut 4096 parties, 2000 pas, threads = cœurs - 1, 1 pas par action,
+        piste par défaut) */
+
+#include "../headers/vecenv.hpp"
+#include "../headers/random.hpp"
+#include "../headers/threadpool.hpp"
+#include <SDL2/SDL.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    const size_t envs = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    const int steps = argc > 2 ? std::atoi(argv[2]) : 2000;
+    const unsigned int threads = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 0;
+    const int ticksPerStep = argc > 4 ? std::atoi(argv[4]) : 1;
+    const int lanes = argc > 5 ? std::atoi(argv[5]) : LANES;
+
+    const TrackConfig* track = findTrackConfig(lanes);
+    if (!track) {
+        std::cerr << "Unsupported lane count " << lanes << std::endl;
+        return 1;
+    }
+
+    ThreadPool pool(threads, "env");
+    VecEnv env(envs, pool, ticksPerStep, *track);
+
+    std::vector<Uint64> seeds(envs);
+    for (size_t i = 0; i < envs; i++) seeds[i] = i + 1;
+    env.reset(seeds.data());
+
+    // Les actions sont tirées hors de la mesure : seul step() est chronométré
+    Pcg32 rng(12345, 3);
+    std::vector<Uint8> actions(envs);
+    Uint64 episodes = 0;
+    Uint64 wins = 0;
+    double totalReward = 0.0;
+    Uint64 elapsed = 0;
+
+    for (int s = 0; s < steps; s++) {
+        for (size_t i = 0; i < envs; i++) {
+            // Agent aléatoire : la plupart du temps aucune action
+            Uint8 choice = static_cast<Uint8>(rng.nextBelow(16));
+            actions[i] = choice < VecEnv::ACTION_COUNT ? choice : static_cast<Uint8>(VecEnv::NOOP);
+        }
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        env.step(actions.data());
+        elapsed += SDL_GetPerformanceCounter() - start;
+
+        const float* rewards = env.getRewards();
+        const Uint8* dones = env.getDones();
+        const Uint8* won = env.getWins();
+        for (size_t i = 0; i < envs; i++) {
+            totalReward += rewards[i];
+            episodes += dones[i];
+            wins += won[i];
+        }
+    }
+
+    const double seconds = static_cast<double>(elapsed) / SDL_GetPerformanceFrequency();
+    const double envSteps = static_cast<double>(envs) * steps;
+    std::cout << track->lanes << " lanes, " << envs << " envs x " << steps << " steps on " << pool.size() + 1 << " threads: "
+              << seconds << " s, " << (seconds > 0.0 ? envSteps / seconds / 1e6 : 0.0) << " M env-steps/s ("
+              << (seconds > 0.0 ? envSteps * ticksPerStep / seconds / 1e6 : 0.0) << " M ticks/s)" << std::endl;
+    std::cout << episodes << " episodes finished, " << wins << " won, mean reward per step "
+              << totalReward / envSteps << std::endl;
+    return 0;
+}